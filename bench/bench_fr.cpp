@@ -0,0 +1,456 @@
+#include <benchmark/benchmark.h>
+
+#include <thread>
+#include <vector>
+
+#include "impl/os_rng.h"
+
+#include "field/fr.h"
+#include "field/fr_vec.h"
+#include "field/montgomery.h"
+#include "random/chacha20_rng.h"
+
+using rng::impl::OsRng;
+
+using jubjub::field::Fr;
+using jubjub::field::FrVec;
+
+using jubjub::random::ChaCha20Rng;
+
+static void BM_FrAdd(benchmark::State &state) {
+    OsRng rng{};
+    Fr a = Fr::random(rng);
+    const Fr b = Fr::random(rng);
+    for (auto _: state) {
+        a += b;
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_FrAdd);
+
+static void BM_FrSub(benchmark::State &state) {
+    OsRng rng{};
+    Fr a = Fr::random(rng);
+    const Fr b = Fr::random(rng);
+    for (auto _: state) {
+        a -= b;
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_FrSub);
+
+static void BM_FrNeg(benchmark::State &state) {
+    OsRng rng{};
+    Fr a = Fr::random(rng);
+    for (auto _: state) {
+        a = -a;
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_FrNeg);
+
+static void BM_FrMul(benchmark::State &state) {
+    OsRng rng{};
+    Fr a = Fr::random(rng);
+    const Fr b = Fr::random(rng);
+    for (auto _: state) {
+        a *= b;
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_FrMul);
+
+static void BM_FrSquare(benchmark::State &state) {
+    OsRng rng{};
+    Fr a = Fr::random(rng);
+    for (auto _: state) {
+        a = a.square();
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_FrSquare);
+
+static void BM_FrInvert(benchmark::State &state) {
+    OsRng rng{};
+    Fr a = Fr::random(rng);
+    for (auto _: state) {
+        a = a.invert(static_cast<Fr::Inversion>(state.range(0))).value();
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_FrInvert)
+        ->Arg(static_cast<int64_t>(Fr::Inversion::ADDITION_CHAIN))
+        ->Arg(static_cast<int64_t>(Fr::Inversion::SAFEGCD));
+
+namespace montgomery = jubjub::field::montgomery;
+
+static constexpr montgomery::Limbs MODULUS_LIMBS = {
+        0xd0970e5ed6f72cb7, 0xa6682093ccc81082,
+        0x06673b0101343b00, 0x0e7db4ea6533afa9,
+};
+static constexpr uint64_t MODULUS_INV = 0x1ba3a358ef788ef9;
+
+static void BM_MontgomeryMulPortable(benchmark::State &state) {
+    montgomery::Limbs a = {1, 2, 3, 4};
+    const montgomery::Limbs b = {5, 6, 7, 8};
+    for (auto _: state) {
+        a = montgomery::portable::mul(a, b, MODULUS_LIMBS, MODULUS_INV);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_MontgomeryMulPortable);
+
+static void BM_MontgomerySquarePortable(benchmark::State &state) {
+    montgomery::Limbs a = {1, 2, 3, 4};
+    for (auto _: state) {
+        a = montgomery::portable::square(a, MODULUS_LIMBS, MODULUS_INV);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_MontgomerySquarePortable);
+
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+static void BM_MontgomeryMulMulxAdx(benchmark::State &state) {
+    if (montgomery::detect() != montgomery::Backend::MULX_ADX) {
+        state.SkipWithError("MULX/ADX not supported");
+        return;
+    }
+    montgomery::Limbs a = {1, 2, 3, 4};
+    const montgomery::Limbs b = {5, 6, 7, 8};
+    for (auto _: state) {
+        a = montgomery::mulx_adx::mul(a, b, MODULUS_LIMBS, MODULUS_INV);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_MontgomeryMulMulxAdx);
+
+static void BM_MontgomerySquareMulxAdx(benchmark::State &state) {
+    if (montgomery::detect() != montgomery::Backend::MULX_ADX) {
+        state.SkipWithError("MULX/ADX not supported");
+        return;
+    }
+    montgomery::Limbs a = {1, 2, 3, 4};
+    for (auto _: state) {
+        a = montgomery::mulx_adx::square(a, MODULUS_LIMBS, MODULUS_INV);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(BM_MontgomerySquareMulxAdx);
+#endif
+
+static void BM_FrPow(benchmark::State &state) {
+    OsRng rng{};
+    const Fr a = Fr::random(rng);
+    const std::array<uint64_t, Fr::WIDTH> exp = {rng.next_u64(), rng.next_u64(), rng.next_u64(), rng.next_u64()};
+    for (auto _: state) {
+        benchmark::DoNotOptimize(state.range(0) ? a.pow_vartime(exp) : a.pow(exp));
+    }
+}
+BENCHMARK(BM_FrPow)->ArgName("vartime")->Arg(0)->Arg(1);
+
+static void BM_FrPowShort(benchmark::State &state) {
+    OsRng rng{};
+    const Fr a = Fr::random(rng);
+    const std::array<uint64_t, Fr::WIDTH> exp = {rng.next_u64(), 0, 0, 0};
+    for (auto _: state) {
+        benchmark::DoNotOptimize(state.range(0) ? a.pow_vartime(exp) : a.pow(exp));
+    }
+}
+BENCHMARK(BM_FrPowShort)->ArgName("vartime")->Arg(0)->Arg(1);
+
+static void BM_FrMultiPowVartime(benchmark::State &state) {
+    OsRng rng{};
+    std::vector<Fr> bases(state.range(0));
+    std::vector<std::array<uint64_t, Fr::WIDTH>> exps(state.range(0));
+    for (size_t i = 0; i < bases.size(); ++i) {
+        bases[i] = Fr::random(rng);
+        exps[i] = {rng.next_u64(), rng.next_u64(), rng.next_u64(), rng.next_u64()};
+    }
+    for (auto _: state) {
+        benchmark::DoNotOptimize(Fr::multi_pow_vartime(bases, exps));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FrMultiPowVartime)->Arg(2)->Arg(8)->Arg(32);
+
+static void BM_FrSqrt(benchmark::State &state) {
+    OsRng rng{};
+    Fr a = Fr::random(rng).square();
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a.sqrt());
+    }
+}
+BENCHMARK(BM_FrSqrt);
+
+static void BM_FrLegendre(benchmark::State &state) {
+    OsRng rng{};
+    Fr a = Fr::random(rng);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a.legendre());
+    }
+}
+BENCHMARK(BM_FrLegendre);
+
+static void BM_FrWnaf(benchmark::State &state) {
+    OsRng rng{};
+    const Fr a = Fr::random(rng);
+    std::array<int8_t, 256> digits{};
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a.wnaf(static_cast<uint8_t>(state.range(0)), digits));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_FrWnaf)->Arg(3)->Arg(5);
+
+static void BM_FrRadix2w(benchmark::State &state) {
+    OsRng rng{};
+    const Fr a = Fr::random(rng);
+    std::array<int8_t, 256> digits{};
+    for (auto _: state) {
+        benchmark::DoNotOptimize(a.radix_2w(static_cast<uint8_t>(state.range(0)), digits));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_FrRadix2w)->Arg(4)->Arg(5);
+
+static void BM_FrSumOfProducts(benchmark::State &state) {
+    OsRng rng{};
+    std::vector<Fr> a(state.range(1));
+    std::vector<Fr> b(state.range(1));
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = Fr::random(rng);
+        b[i] = Fr::random(rng);
+    }
+    for (auto _: state) {
+        if (state.range(0)) {
+            benchmark::DoNotOptimize(Fr::sum_of_products(a, b));
+        } else {
+            Fr acc = Fr::zero();
+            for (size_t i = 0; i < a.size(); ++i)
+                acc += a[i] * b[i];
+            benchmark::DoNotOptimize(acc);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_FrSumOfProducts)->ArgNames({"lazy", "n"})->ArgsProduct({{0, 1}, {16, 1024}});
+
+static void BM_FrSum(benchmark::State &state) {
+    OsRng rng{};
+    std::vector<Fr> values(state.range(1));
+    for (auto &value: values)
+        value = Fr::random(rng);
+    for (auto _: state) {
+        if (state.range(0)) {
+            benchmark::DoNotOptimize(Fr::sum(values));
+        } else {
+            Fr acc = Fr::zero();
+            for (const auto &value: values)
+                acc += value;
+            benchmark::DoNotOptimize(acc);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_FrSum)->ArgNames({"lazy", "n"})->ArgsProduct({{0, 1}, {16, 1024}});
+
+static void BM_FrRandom(benchmark::State &state) {
+    OsRng os_rng{};
+    ChaCha20Rng chacha_rng{};
+    std::vector<Fr> values(4096);
+
+    for (auto _: state) {
+        switch (state.range(0)) {
+            case 0:
+                for (auto &value: values)
+                    value = Fr::random(os_rng);
+                break;
+            case 1:
+                Fr::random_batch(os_rng, values);
+                break;
+            default:
+                Fr::random_batch(chacha_rng, values);
+                break;
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_FrRandom)->ArgName("mode")->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_FrFromBytesWide(benchmark::State &state) {
+    OsRng rng{};
+    std::array<uint8_t, Fr::BYTE_SIZE * 2> bytes{};
+    rng.fill_bytes(bytes);
+
+    for (auto _: state) {
+        bytes[0] += 1;
+        benchmark::DoNotOptimize(Fr::from_bytes_wide(bytes));
+    }
+}
+BENCHMARK(BM_FrFromBytesWide);
+
+static void BM_FrHashToScalar(benchmark::State &state) {
+    std::vector<uint8_t> message(static_cast<size_t>(state.range(1)));
+    for (size_t i = 0; i < message.size(); ++i)
+        message[i] = static_cast<uint8_t>(i);
+    std::vector<std::span<const uint8_t>> messages(1024, message);
+    std::vector<Fr> scalars(messages.size());
+
+    for (auto _: state) {
+        if (state.range(0)) {
+            Fr::hash_to_scalar_batch("Jubjub", messages, scalars);
+        } else {
+            for (size_t i = 0; i < messages.size(); ++i)
+                scalars[i] = Fr::hash_to_scalar("Jubjub", messages[i]);
+        }
+        benchmark::DoNotOptimize(scalars.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+}
+BENCHMARK(BM_FrHashToScalar)->ArgNames({"batch", "bytes"})->ArgsProduct({{0, 1}, {32, 200}});
+
+static void BM_FrToBlsScalar(benchmark::State &state) {
+    OsRng rng{};
+    std::vector<Fr> values(4096);
+    for (auto &value: values)
+        value = Fr::random(rng);
+    std::vector<bls12_381::scalar::Scalar> scalars(values.size());
+
+    for (auto _: state) {
+        switch (state.range(0)) {
+            case 0:
+                for (size_t i = 0; i < values.size(); ++i)
+                    scalars[i] = bls12_381::scalar::Scalar::from_bytes(values[i].to_bytes()).value();
+                break;
+            case 1:
+                for (size_t i = 0; i < values.size(); ++i)
+                    scalars[i] = values[i].to_bls_scalar().value();
+                break;
+            default:
+                Fr::to_bls_scalar_batch(values, scalars);
+                break;
+        }
+        benchmark::DoNotOptimize(scalars.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_FrToBlsScalar)->ArgName("mode")->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_FrDecode(benchmark::State &state) {
+    OsRng rng{};
+    std::vector<Fr> values(4096);
+    for (auto &value: values)
+        value = Fr::random(rng);
+    std::vector<uint8_t> bytes(values.size() * Fr::BYTE_SIZE);
+    Fr::encode_batch(values, bytes);
+
+    for (auto _: state) {
+        if (state.range(0)) {
+            benchmark::DoNotOptimize(Fr::decode_batch(bytes, values));
+        } else {
+            for (size_t i = 0; i < values.size(); ++i) {
+                std::array<uint8_t, Fr::BYTE_SIZE> encoding{};
+                std::copy_n(bytes.begin() + i * Fr::BYTE_SIZE, Fr::BYTE_SIZE, encoding.begin());
+                values[i] = Fr::from_bytes(encoding).value();
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_FrDecode)->ArgName("batch")->Arg(0)->Arg(1);
+
+static void BM_FrEncode(benchmark::State &state) {
+    OsRng rng{};
+    std::vector<Fr> values(4096);
+    for (auto &value: values)
+        value = Fr::random(rng);
+    std::vector<uint8_t> bytes(values.size() * Fr::BYTE_SIZE);
+
+    for (auto _: state) {
+        if (state.range(0)) {
+            Fr::encode_batch(values, bytes);
+        } else {
+            for (size_t i = 0; i < values.size(); ++i) {
+                const auto encoding = values[i].to_bytes();
+                std::copy(encoding.begin(), encoding.end(), bytes.begin() + i * Fr::BYTE_SIZE);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_FrEncode)->ArgName("batch")->Arg(0)->Arg(1);
+
+static void BM_FrVecMul(benchmark::State &state) {
+    const auto backend = static_cast<FrVec::Backend>(state.range(0));
+    if (!FrVec::is_supported(backend)) {
+        state.SkipWithError("backend not supported");
+        return;
+    }
+
+    OsRng rng{};
+    std::vector<Fr> values(1024);
+    for (auto &value: values)
+        value = Fr::random(rng);
+    const FrVec a{values};
+    FrVec out{values.size()};
+    for (auto _: state) {
+        FrVec::mul(out, out, a, backend);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_FrVecMul)->ArgName("backend")->DenseRange(0, 2);
+
+static void BM_FrVecAdd(benchmark::State &state) {
+    const auto backend = static_cast<FrVec::Backend>(state.range(0));
+    if (!FrVec::is_supported(backend)) {
+        state.SkipWithError("backend not supported");
+        return;
+    }
+
+    OsRng rng{};
+    std::vector<Fr> values(1024);
+    for (auto &value: values)
+        value = Fr::random(rng);
+    const FrVec a{values};
+    FrVec out{values.size()};
+    for (auto _: state) {
+        FrVec::add(out, out, a, backend);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_FrVecAdd)->ArgName("backend")->DenseRange(0, 2);
+
+static void BM_FrBatchInvert(benchmark::State &state) {
+    OsRng rng{};
+    std::vector<Fr> values;
+    for (int64_t i = 0; i < state.range(0); ++i)
+        values.push_back(Fr::random(rng));
+    for (auto _: state) {
+        Fr::batch_invert(values);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FrBatchInvert)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void BM_FrBatchInvertParallel(benchmark::State &state) {
+    OsRng rng{};
+    std::vector<Fr> values;
+    for (int64_t i = 0; i < state.range(0); ++i)
+        values.push_back(Fr::random(rng));
+    const auto threads = std::max(std::thread::hardware_concurrency(), 1U);
+    for (auto _: state) {
+        Fr::batch_invert(values, threads);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FrBatchInvertParallel)->Arg(65536)->UseRealTime();
\ No newline at end of file
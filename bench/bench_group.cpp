@@ -0,0 +1,248 @@
+#include <benchmark/benchmark.h>
+
+#include "impl/os_rng.h"
+
+#include "field/fr.h"
+#include "group/affine.h"
+#include "group/affine_niels.h"
+#include "group/completed.h"
+#include "group/constants.h"
+#include "group/extended.h"
+#include "group/extended_niels.h"
+#include "group/fixed_base.h"
+#include "group/fixed_base_cache.h"
+#include "group/msm.h"
+#include "group/multiply_many.h"
+
+using rng::impl::OsRng;
+
+using jubjub::field::Fq;
+using jubjub::field::Fr;
+using jubjub::group::Affine;
+using jubjub::group::AffineNiels;
+using jubjub::group::Completed;
+using jubjub::group::Extended;
+using jubjub::group::ExtendedNiels;
+using jubjub::group::FixedBaseCache;
+using jubjub::group::FixedBaseTable;
+
+using jubjub::group::constant::GENERATOR;
+using jubjub::group::constant::GENERATOR_EXTENDED;
+
+// the completed-point formulas, fully reducing every intermediate, as a baseline for the fused kernels; kept out
+// of line like the library calls they are compared with
+[[gnu::noinline]] static Extended completed_double(const Extended &p) {
+    const Fq x{p.get_x()}, y{p.get_y()}, z{p.get_z()};
+    const Fq xx = x.square();
+    const Fq yy = y.square();
+    const Fq zz2 = z.square().doubles();
+    const Fq xy2 = (x + y).square();
+    return Extended{Completed{xy2 - (yy + xx), yy + xx, yy - xx, zz2 - (yy - xx)}};
+}
+
+[[gnu::noinline]] static Extended completed_add(const Extended &p, const Fq &y_plus_x, const Fq &y_minus_x,
+                                                const Fq &z, const Fq &t2d) {
+    const Fq x{p.get_x()}, y{p.get_y()}, t1{p.get_t1()}, t2{p.get_t2()};
+    const Fq a = (y - x) * y_minus_x;
+    const Fq b = (y + x) * y_plus_x;
+    const Fq c = t1 * t2 * t2d;
+    const Fq d = (Fq{p.get_z()} * z).doubles();
+    return Extended{Completed{b - a, b + a, d + c, d - c}};
+}
+
+static void BM_ExtendedDoubleCompleted(benchmark::State &state) {
+    Extended p = GENERATOR_EXTENDED;
+    for (auto _: state) {
+        p = completed_double(p);
+        benchmark::DoNotOptimize(p);
+    }
+}
+BENCHMARK(BM_ExtendedDoubleCompleted);
+
+static void BM_ExtendedAddCompleted(benchmark::State &state) {
+    Extended p = GENERATOR_EXTENDED;
+    const ExtendedNiels q{GENERATOR_EXTENDED.doubles()};
+    const Fq y_plus_x{q.get_y_plus_x()}, y_minus_x{q.get_y_minus_x()}, z{q.get_z()}, t2d{q.get_t2d()};
+    for (auto _: state) {
+        p = completed_add(p, y_plus_x, y_minus_x, z, t2d);
+        benchmark::DoNotOptimize(p);
+    }
+}
+BENCHMARK(BM_ExtendedAddCompleted);
+
+static void BM_ExtendedAddExtendedCompleted(benchmark::State &state) {
+    Extended p = GENERATOR_EXTENDED;
+    const Extended q = GENERATOR_EXTENDED.doubles();
+    for (auto _: state) {
+        const ExtendedNiels niels{q};
+        p = completed_add(p, Fq{niels.get_y_plus_x()}, Fq{niels.get_y_minus_x()}, Fq{niels.get_z()},
+                          Fq{niels.get_t2d()});
+        benchmark::DoNotOptimize(p);
+    }
+}
+BENCHMARK(BM_ExtendedAddExtendedCompleted);
+
+static void BM_ExtendedDouble(benchmark::State &state) {
+    Extended p = GENERATOR_EXTENDED;
+    for (auto _: state) {
+        p = p.doubles();
+        benchmark::DoNotOptimize(p);
+    }
+}
+BENCHMARK(BM_ExtendedDouble);
+
+static void BM_ExtendedAddExtendedNiels(benchmark::State &state) {
+    Extended p = GENERATOR_EXTENDED;
+    const ExtendedNiels q{GENERATOR_EXTENDED.doubles()};
+    for (auto _: state) {
+        p += q;
+        benchmark::DoNotOptimize(p);
+    }
+}
+BENCHMARK(BM_ExtendedAddExtendedNiels);
+
+static void BM_ExtendedAddAffineNiels(benchmark::State &state) {
+    Extended p = GENERATOR_EXTENDED;
+    const AffineNiels q{GENERATOR};
+    for (auto _: state) {
+        p += q;
+        benchmark::DoNotOptimize(p);
+    }
+}
+BENCHMARK(BM_ExtendedAddAffineNiels);
+
+static void BM_ExtendedAddExtended(benchmark::State &state) {
+    Extended p = GENERATOR_EXTENDED;
+    const Extended q = GENERATOR_EXTENDED.doubles();
+    for (auto _: state) {
+        p += q;
+        benchmark::DoNotOptimize(p);
+    }
+}
+BENCHMARK(BM_ExtendedAddExtended);
+
+static void BM_ExtendedMultiply(benchmark::State &state) {
+    OsRng rng{};
+    const Fr scalar = Fr::random(rng);
+    for (auto _: state)
+        benchmark::DoNotOptimize(GENERATOR_EXTENDED * scalar);
+}
+BENCHMARK(BM_ExtendedMultiply);
+
+static void BM_ExtendedMultiplyVartime(benchmark::State &state) {
+    OsRng rng{};
+    const Fr scalar = Fr::random(rng);
+    for (auto _: state)
+        benchmark::DoNotOptimize(GENERATOR_EXTENDED.multiply_vartime(scalar));
+}
+BENCHMARK(BM_ExtendedMultiplyVartime);
+
+static void BM_FixedBaseGenerator(benchmark::State &state) {
+    OsRng rng{};
+    const Fr scalar = Fr::random(rng);
+    const FixedBaseTable &table = FixedBaseTable::generator();
+    for (auto _: state)
+        benchmark::DoNotOptimize(table.multiply(scalar));
+}
+BENCHMARK(BM_FixedBaseGenerator);
+
+static void BM_FixedBaseCacheHit(benchmark::State &state) {
+    OsRng rng{};
+    const Fr scalar = Fr::random(rng);
+    const Extended base = GENERATOR_EXTENDED * Fr::random(rng);
+    FixedBaseCache cache{};
+    for (auto _: state)
+        benchmark::DoNotOptimize(cache.multiply(base, scalar));
+}
+BENCHMARK(BM_FixedBaseCacheHit);
+
+static void BM_FixedBaseBuild(benchmark::State &state) {
+    for (auto _: state)
+        benchmark::DoNotOptimize(FixedBaseTable{GENERATOR_EXTENDED});
+}
+BENCHMARK(BM_FixedBaseBuild);
+
+static void BM_Msm(benchmark::State &state) {
+    OsRng rng{};
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<Extended> points{GENERATOR_EXTENDED * Fr::random(rng)};
+    std::vector<Fr> scalars{Fr::random(rng)};
+    while (points.size() < n) {
+        points.push_back(points.back() + points.front());
+        scalars.push_back(Fr::random(rng));
+    }
+    for (auto _: state)
+        benchmark::DoNotOptimize(jubjub::group::msm(points, scalars));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_Msm)->Arg(2)->Arg(16)->Arg(128)->Arg(1024)->Arg(16384);
+
+static void BM_MsmNaive(benchmark::State &state) {
+    OsRng rng{};
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<Extended> points{GENERATOR_EXTENDED * Fr::random(rng)};
+    std::vector<Fr> scalars{Fr::random(rng)};
+    while (points.size() < n) {
+        points.push_back(points.back() + points.front());
+        scalars.push_back(Fr::random(rng));
+    }
+    for (auto _: state) {
+        Extended acc = Extended::identity();
+        for (size_t i = 0; i < n; ++i)
+            acc += points[i] * scalars[i];
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_MsmNaive)->Arg(2)->Arg(16)->Arg(128);
+
+static void BM_DoubleScalarMul(benchmark::State &state) {
+    OsRng rng{};
+    const Fr a = Fr::random(rng), b = Fr::random(rng);
+    const Extended q = GENERATOR_EXTENDED.doubles();
+    for (auto _: state)
+        benchmark::DoNotOptimize(Extended::double_scalar_mul(a, GENERATOR_EXTENDED, b, q));
+}
+BENCHMARK(BM_DoubleScalarMul);
+
+static void BM_DoubleScalarMulVartime(benchmark::State &state) {
+    OsRng rng{};
+    const Fr a = Fr::random(rng), b = Fr::random(rng);
+    const Extended q = GENERATOR_EXTENDED.doubles();
+    for (auto _: state)
+        benchmark::DoNotOptimize(Extended::double_scalar_mul_vartime(a, GENERATOR_EXTENDED, b, q));
+}
+BENCHMARK(BM_DoubleScalarMulVartime);
+
+static void BM_MultiplyMany(benchmark::State &state) {
+    OsRng rng{};
+    const Fr scalar = Fr::random(rng);
+    std::vector<Extended> points(static_cast<size_t>(state.range(0)), GENERATOR_EXTENDED);
+    for (auto _: state) {
+        jubjub::group::multiply_many(scalar, points);
+        benchmark::DoNotOptimize(points);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MultiplyMany)->Arg(1)->Arg(2)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_ExtendedIsTorsionFree(benchmark::State &state) {
+    const Extended p = GENERATOR_EXTENDED.doubles();
+    for (auto _: state)
+        benchmark::DoNotOptimize(p.is_torsion_free());
+}
+BENCHMARK(BM_ExtendedIsTorsionFree);
+
+static void BM_AffineFromExtended(benchmark::State &state) {
+    const Extended p = GENERATOR_EXTENDED.doubles();
+    for (auto _: state)
+        benchmark::DoNotOptimize(Affine{p});
+}
+BENCHMARK(BM_AffineFromExtended);
+
+static void BM_AffineFromBytes(benchmark::State &state) {
+    const auto bytes = GENERATOR.to_bytes();
+    for (auto _: state)
+        benchmark::DoNotOptimize(Affine::from_bytes(bytes));
+}
+BENCHMARK(BM_AffineFromBytes);
\ No newline at end of file
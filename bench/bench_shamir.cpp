@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "impl/os_rng.h"
+
+#include "field/fr.h"
+#include "sharing/shamir.h"
+
+using rng::impl::OsRng;
+
+using jubjub::field::Fr;
+using jubjub::sharing::Polynomial;
+using jubjub::sharing::Share;
+using jubjub::sharing::SignerSet;
+
+static void BM_ShamirEvaluate(benchmark::State &state) {
+    OsRng rng{};
+    const Polynomial polynomial = Polynomial::random(Fr::random(rng), 16, rng);
+    std::vector<Fr> xs(1024);
+    for (size_t i = 0; i < xs.size(); ++i)
+        xs[i] = Fr{i + 1};
+    std::vector<Fr> ys(xs.size());
+
+    for (auto _: state) {
+        if (state.range(0)) {
+            polynomial.evaluate(xs, ys);
+        } else {
+            for (size_t i = 0; i < xs.size(); ++i)
+                ys[i] = polynomial.evaluate(xs[i]);
+        }
+        benchmark::DoNotOptimize(ys.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(xs.size()));
+}
+BENCHMARK(BM_ShamirEvaluate)->ArgName("batch")->Arg(0)->Arg(1);
+
+static void BM_ShamirSignerSet(benchmark::State &state) {
+    std::vector<Fr> indices(static_cast<size_t>(state.range(1)));
+    for (size_t i = 0; i < indices.size(); ++i)
+        indices[i] = Fr{2 * i + 1};
+
+    for (auto _: state) {
+        if (state.range(0)) {
+            benchmark::DoNotOptimize(SignerSet::from_indices(indices));
+        } else {
+            // one inversion per coefficient
+            std::vector<Fr> coefficients(indices.size());
+            for (size_t i = 0; i < indices.size(); ++i) {
+                Fr numerator = Fr::one();
+                Fr denominator = Fr::one();
+                for (size_t j = 0; j < indices.size(); ++j) {
+                    if (j == i) continue;
+                    numerator *= indices[j];
+                    denominator *= indices[j] - indices[i];
+                }
+                coefficients[i] = numerator * denominator.invert().value();
+            }
+            benchmark::DoNotOptimize(coefficients.data());
+        }
+    }
+}
+BENCHMARK(BM_ShamirSignerSet)->ArgNames({"batch", "t"})->ArgsProduct({{0, 1}, {3, 16, 64}});
+
+static void BM_ShamirReconstruct(benchmark::State &state) {
+    OsRng rng{};
+    const Polynomial polynomial = Polynomial::random(Fr::random(rng), 16, rng);
+    const std::vector<Share> shares = polynomial.split(16);
+    const SignerSet signers = SignerSet::from_indices(
+            [&]() {
+                std::vector<Fr> indices;
+                for (const Share &share: shares)
+                    indices.push_back(share.index);
+                return indices;
+            }()
+    ).value();
+
+    for (auto _: state) {
+        if (state.range(0)) {
+            benchmark::DoNotOptimize(signers.reconstruct(shares));
+        } else {
+            benchmark::DoNotOptimize(jubjub::sharing::reconstruct(shares));
+        }
+    }
+}
+BENCHMARK(BM_ShamirReconstruct)->ArgName("cached")->Arg(0)->Arg(1);
\ No newline at end of file
@@ -0,0 +1,10 @@
+INCLUDE(FetchContent)
+FETCHCONTENT_DECLARE(
+        benchmark
+        URL https://github.com/google/benchmark/archive/refs/tags/v1.8.3.zip
+)
+
+SET(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+SET(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+
+FETCHCONTENT_MAKEAVAILABLE(benchmark)
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "field/fr.h"
 #include "group/extended.h"
 
+namespace jubjub::group { class FixedBaseCache; }
+
 namespace jubjub::elgamal {
 
 class Cipher {
@@ -25,6 +27,9 @@ public:
 
     static std::optional<Cipher> from_bytes(const std::array<uint8_t, Cipher::BYTE_SIZE> &bytes);
     static Cipher encrypt(const field::Fr &sec, const group::Extended &pub, const group::Extended &gen, const group::Extended &msg);
+    /// Encrypts like the overload above, taking `sec * pub` from `cache`, which pays off for recipients that recur.
+    static Cipher encrypt(const field::Fr &sec, const group::Extended &pub, const group::Extended &gen,
+                          const group::Extended &msg, group::FixedBaseCache &cache);
 
     [[nodiscard]] std::array<uint8_t, Cipher::BYTE_SIZE> to_bytes() const;
     [[nodiscard]] group::Extended decrypt(const field::Fr &sec) const;
@@ -0,0 +1,31 @@
+#ifndef JUBJUB_FIELD_ARITHMETIC_H
+#define JUBJUB_FIELD_ARITHMETIC_H
+
+#include <cstdint>
+
+namespace jubjub::field::arithmetic {
+
+/// Computes `a + b + carry`, returning the result and storing the new carry.
+inline constexpr uint64_t adc(uint64_t a, uint64_t b, uint64_t &carry) {
+    const unsigned __int128 ret = static_cast<unsigned __int128>(a) + b + carry;
+    carry = static_cast<uint64_t>(ret >> 64);
+    return static_cast<uint64_t>(ret);
+}
+
+/// Computes `a - (b + borrow)`, returning the result and storing the new borrow as an all-ones mask.
+inline constexpr uint64_t sbb(uint64_t a, uint64_t b, uint64_t &borrow) {
+    const unsigned __int128 ret = static_cast<unsigned __int128>(a) - (static_cast<unsigned __int128>(b) + (borrow >> 63));
+    borrow = static_cast<uint64_t>(ret >> 64);
+    return static_cast<uint64_t>(ret);
+}
+
+/// Computes `a + (b * c) + carry`, returning the result and storing the new carry.
+inline constexpr uint64_t mac(uint64_t a, uint64_t b, uint64_t c, uint64_t &carry) {
+    const unsigned __int128 ret = static_cast<unsigned __int128>(a) + static_cast<unsigned __int128>(b) * c + carry;
+    carry = static_cast<uint64_t>(ret >> 64);
+    return static_cast<uint64_t>(ret);
+}
+
+} // namespace jubjub::field::arithmetic
+
+#endif //JUBJUB_FIELD_ARITHMETIC_H
\ No newline at end of file
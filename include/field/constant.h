@@ -1,40 +1,44 @@
 #ifndef JUBJUB_FIELD_CONSTANT_H
 #define JUBJUB_FIELD_CONSTANT_H
 
+#include "field/fq.h"
 #include "field/fr.h"
+#include "field/montgomery.h"
 
 namespace jubjub::field::constant {
 
-const Fr MODULUS(
-        {
-                0xd0970e5ed6f72cb7, 0xa6682093ccc81082,
-                0x06673b0101343b00, 0x0e7db4ea6533afa9,
-        }
-);
+inline constexpr Fr MODULUS{Fr::MODULUS_LIMBS};
 
-const uint64_t INV = 0x1ba3a358ef788ef9;
+inline constexpr uint64_t INV = Fr::INV;
 
-const Fr R1(
+inline constexpr Fr R1(
         {
                 0x25f80bb3b99607d9, 0xf315d62f66b6e750,
                 0x932514eeeb8814f4, 0x09a6fc6f479155c6,
         }
 );
 
-const Fr R2(
+inline constexpr Fr R2(
         {
                 0x67719aa495e57731, 0x51b0cef09ce3fc26,
                 0x69dab7fac026e9a5, 0x04f6547b8d127688,
         }
 );
 
-const Fr R3(
+inline constexpr Fr R3(
         {
                 0xe0d6c6563d830544, 0x323e3883598d0f85,
                 0xf0fea3004c2e2ba8, 0x05874f84946737ec,
         }
 );
 
+static_assert(INV == montgomery::neg_inverse(Fr::MODULUS_LIMBS), "INV must be -MODULUS^-1 mod 2^64");
+static_assert(R1 == Fr{montgomery::pow2_mod(Fr::MODULUS_LIMBS, 256)}, "R1 must be 2^256 mod MODULUS");
+static_assert(R2 == Fr{montgomery::pow2_mod(Fr::MODULUS_LIMBS, 512)}, "R2 must be 2^512 mod MODULUS");
+static_assert(R3 == Fr{montgomery::pow2_mod(Fr::MODULUS_LIMBS, 768)}, "R3 must be 2^768 mod MODULUS");
+
+static_assert(Fr::MODULUS_LIMBS[3] < Fq::MODULUS_LIMBS[3], "every Fr value must be a valid Fq value");
+
 } // namespace jubjub::field::constant
 
 #endif //JUBJUB_FIELD_CONSTANT_H
\ No newline at end of file
@@ -0,0 +1,135 @@
+#ifndef JUBJUB_FIELD_EXPONENT_H
+#define JUBJUB_FIELD_EXPONENT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// Exponentiation by exponents that are known at compile time.
+///
+/// `Chain<EXP>` plans a left-to-right sliding-window schedule for `EXP` during compilation, choosing the window
+/// width that minimises the total number of multiplications and squarings. At runtime only the planned
+/// operations are executed, and since the schedule never depends on the base it is constant-time in the base.
+namespace jubjub::field::exponent {
+
+using Exponent = std::array<uint64_t, 4>;
+
+struct Step {
+    uint16_t squarings;
+    int16_t index;
+};
+
+constexpr bool bit(const Exponent &exp, int32_t i) {
+    return (exp[i / 64] >> (i % 64)) & 1;
+}
+
+constexpr int32_t bit_length(const Exponent &exp) {
+    for (int32_t i = 255; i >= 0; --i)
+        if (bit(exp, i)) return i + 1;
+    return 0;
+}
+
+/// Walks the sliding-window decomposition of `exp`, reporting each window as `(squarings, odd value)`.
+template<typename F>
+constexpr void for_each_window(const Exponent &exp, int32_t width, F &&emit) {
+    int32_t squarings = 0;
+    int32_t i = bit_length(exp) - 1;
+    while (i >= 0) {
+        if (!bit(exp, i)) {
+            squarings += 1;
+            i -= 1;
+            continue;
+        }
+
+        int32_t j = i - width + 1 < 0 ? 0 : i - width + 1;
+        while (!bit(exp, j)) j += 1;
+
+        uint32_t value = 0;
+        for (int32_t k = i; k >= j; --k)
+            value = (value << 1) | static_cast<uint32_t>(bit(exp, k));
+
+        emit(squarings + i - j + 1, value);
+        squarings = 0;
+        i = j - 1;
+    }
+    if (squarings > 0) emit(squarings, 0);
+}
+
+/// Number of field operations spent by a sliding window of the given width, including its table.
+constexpr int32_t cost(const Exponent &exp, int32_t width) {
+    int32_t windows = 0;
+    int32_t squarings = 0;
+    bool first = true;
+    for_each_window(exp, width, [&](int32_t s, uint32_t value) {
+        if (!first) squarings += s;
+        if (value != 0 && !first) windows += 1;
+        first = false;
+    });
+    const int32_t table = width == 1 ? 0 : (1 << (width - 1));
+    return table + windows + squarings;
+}
+
+constexpr int32_t best_width(const Exponent &exp) {
+    int32_t best = 1;
+    for (int32_t width = 2; width <= 8; ++width)
+        if (cost(exp, width) < cost(exp, best)) best = width;
+    return best;
+}
+
+constexpr int32_t step_count(const Exponent &exp, int32_t width) {
+    int32_t count = 0;
+    for_each_window(exp, width, [&](int32_t, uint32_t) { count += 1; });
+    return count;
+}
+
+template<Exponent EXP>
+struct Chain {
+    static_assert(bit_length(EXP) > 0, "the exponent must be non-zero");
+
+    static constexpr int32_t WIDTH = best_width(EXP);
+    static constexpr int32_t TABLE_SIZE = 1 << (WIDTH - 1);
+    static constexpr int32_t OPERATIONS = cost(EXP, WIDTH);
+
+    static constexpr std::array<Step, step_count(EXP, WIDTH)> STEPS = []() {
+        std::array<Step, step_count(EXP, WIDTH)> steps{};
+        size_t n = 0;
+        for_each_window(EXP, WIDTH, [&](int32_t squarings, uint32_t value) {
+            steps[n++] = Step{
+                    static_cast<uint16_t>(squarings),
+                    static_cast<int16_t>(value == 0 ? -1 : static_cast<int32_t>(value >> 1)),
+            };
+        });
+        return steps;
+    }();
+
+    /// Raises `base` to `EXP`, with `T` providing `square()` and `operator*`.
+    template<typename T>
+    static T pow(const T &base) {
+        std::array<T, TABLE_SIZE> table{};
+        table[0] = base;
+        if constexpr (TABLE_SIZE > 1) {
+            const T base2 = base.square();
+            for (int32_t i = 1; i < TABLE_SIZE; ++i)
+                table[i] = table[i - 1] * base2;
+        }
+
+        // the leading window seeds the accumulator, so its squarings are skipped
+        T acc = table[STEPS[0].index];
+        for (size_t i = 1; i < STEPS.size(); ++i) {
+            for (uint16_t j = 0; j < STEPS[i].squarings; ++j)
+                acc = acc.square();
+            if (STEPS[i].index >= 0)
+                acc = acc * table[STEPS[i].index];
+        }
+        return acc;
+    }
+};
+
+template<Exponent EXP, typename T>
+T pow(const T &base) {
+    return Chain<EXP>::pow(base);
+}
+
+} // namespace jubjub::field::exponent
+
+#endif //JUBJUB_FIELD_EXPONENT_H
\ No newline at end of file
@@ -0,0 +1,232 @@
+#ifndef JUBJUB_FQ_H
+#define JUBJUB_FQ_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+#include "scalar/scalar.h"
+
+#include "field/arithmetic.h"
+#include "field/montgomery.h"
+
+namespace jubjub::field {
+
+/// The base field of Jubjub, which is the BLS12-381 scalar field.
+///
+/// `Fq` keeps the same Montgomery limbs as `bls12_381::scalar::Scalar` and converts to and from it by copying
+/// them, but its arithmetic is defined inline here so that the point formulas can be compiled as a whole.
+class Fq {
+public:
+    static constexpr int32_t WIDTH = 4;
+    static constexpr int32_t BYTE_SIZE = Fq::WIDTH * sizeof(uint64_t);
+
+    static constexpr std::array<uint64_t, Fq::WIDTH> MODULUS_LIMBS = {
+            0xffffffff00000001, 0x53bda402fffe5bfe,
+            0x3339d80809a1d805, 0x73eda753299d7d48,
+    };
+    static constexpr uint64_t INV = 0xfffffffeffffffff;
+
+    static constexpr std::array<uint64_t, Fq::WIDTH> R1 = {
+            0x00000001fffffffe, 0x5884b7fa00034802,
+            0x998c4fefecbc4ff5, 0x1824b159acc5056f,
+    };
+    static constexpr std::array<uint64_t, Fq::WIDTH> R2 = {
+            0xc999e990f3f29c6d, 0x2b6cedcb87925c23,
+            0x05d314967254398f, 0x0748d9d99f59ff11,
+    };
+    static constexpr std::array<uint64_t, Fq::WIDTH> R3 = {
+            0xc62c1807439b73af, 0x1b3e0d188cf06990,
+            0x73d13c71c7b5f418, 0x6e2a5bb9c8db33e9,
+    };
+
+private:
+    std::array<uint64_t, Fq::WIDTH> data;
+
+public:
+    constexpr Fq() : data{0} {}
+    constexpr Fq(const Fq &fq) = default;
+    constexpr Fq(Fq &&fq) noexcept = default;
+    constexpr explicit Fq(const std::array<uint64_t, Fq::WIDTH> &data) : data{data} {}
+
+    explicit Fq(const bls12_381::scalar::Scalar &scalar);
+
+    static constexpr Fq zero() noexcept { return Fq{}; }
+    static constexpr Fq one() noexcept { return Fq{Fq::R1}; }
+
+    [[nodiscard]] bls12_381::scalar::Scalar to_scalar() const {
+        return bls12_381::scalar::Scalar{std::array<uint64_t, Fq::WIDTH>(this->data)};
+    }
+
+    [[nodiscard]] bool is_zero() const { return (this->data[0] | this->data[1] | this->data[2] | this->data[3]) == 0; }
+
+    [[nodiscard]] Fq square() const;
+    [[nodiscard]] Fq doubles() const { return *this + *this; }
+    [[nodiscard]] std::optional<Fq> invert() const;
+
+    /// Redundant-form variants, returning values in `[0, 2 * MODULUS)` without the final correction.
+    ///
+    /// A redundant value may only appear as the right operand of a multiplication whose left operand is fully
+    /// reduced, which brings the product back below MODULUS, or be passed to `reduce()`.
+    [[nodiscard]] Fq add_lazy(const Fq &rhs) const;
+    [[nodiscard]] Fq sub_lazy(const Fq &rhs) const;
+    [[nodiscard]] Fq mul_lazy(const Fq &rhs) const;
+    [[nodiscard]] Fq reduce() const { return Fq::subtract_modulus(this->data); }
+
+    static Fq conditional_select(const Fq &a, const Fq &b, bool choice);
+
+private:
+    static Fq subtract_modulus(const std::array<uint64_t, Fq::WIDTH> &limbs);
+
+public:
+    Fq operator-() const;
+    constexpr Fq &operator=(const Fq &rhs) = default;
+    constexpr Fq &operator=(Fq &&rhs) noexcept = default;
+
+    Fq &operator+=(const Fq &rhs);
+    Fq &operator-=(const Fq &rhs);
+    Fq &operator*=(const Fq &rhs);
+
+public:
+    friend inline Fq operator+(const Fq &lhs, const Fq &rhs) { return Fq(lhs) += rhs; }
+    friend inline Fq operator-(const Fq &lhs, const Fq &rhs) { return Fq(lhs) -= rhs; }
+    friend inline Fq operator*(const Fq &lhs, const Fq &rhs) { return Fq(lhs) *= rhs; }
+
+    friend constexpr bool operator==(const Fq &lhs, const Fq &rhs) { return lhs.data == rhs.data; }
+    friend constexpr bool operator!=(const Fq &lhs, const Fq &rhs) { return lhs.data != rhs.data; }
+};
+
+static_assert(montgomery::neg_inverse(Fq::MODULUS_LIMBS) == Fq::INV, "INV must be -MODULUS^-1 mod 2^64");
+static_assert(montgomery::pow2_mod(Fq::MODULUS_LIMBS, 256) == Fq::R1, "R1 must be 2^256 mod MODULUS");
+static_assert(montgomery::pow2_mod(Fq::MODULUS_LIMBS, 512) == Fq::R2, "R2 must be 2^512 mod MODULUS");
+static_assert(montgomery::pow2_mod(Fq::MODULUS_LIMBS, 768) == Fq::R3, "R3 must be 2^768 mod MODULUS");
+
+static_assert(sizeof(Fq) == sizeof(bls12_381::scalar::Scalar) && std::is_standard_layout_v<bls12_381::scalar::Scalar>,
+              "Fq must share the layout of Scalar");
+
+inline Fq::Fq(const bls12_381::scalar::Scalar &scalar) : data{} {
+    std::memcpy(this->data.data(), &scalar, sizeof(this->data));
+}
+
+inline Fq Fq::subtract_modulus(const std::array<uint64_t, Fq::WIDTH> &limbs) {
+    using arithmetic::sbb;
+
+    uint64_t borrow = 0;
+    std::array<uint64_t, Fq::WIDTH> d{};
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        d[i] = sbb(limbs[i], Fq::MODULUS_LIMBS[i], borrow);
+
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        d[i] = (limbs[i] & borrow) | (d[i] & ~borrow);
+    return Fq{d};
+}
+
+inline Fq Fq::conditional_select(const Fq &a, const Fq &b, bool choice) {
+    const uint64_t mask = -static_cast<uint64_t>(choice);
+    std::array<uint64_t, Fq::WIDTH> res{};
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        res[i] = (a.data[i] & ~mask) | (b.data[i] & mask);
+    return Fq{res};
+}
+
+inline Fq Fq::square() const {
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+    if (montgomery::active() == montgomery::Backend::MULX_ADX)
+        return Fq::subtract_modulus(montgomery::mulx_adx::square(this->data, Fq::MODULUS_LIMBS, Fq::INV));
+#endif
+    return Fq::subtract_modulus(montgomery::portable::square(this->data, Fq::MODULUS_LIMBS, Fq::INV));
+}
+
+inline Fq Fq::operator-() const {
+    using arithmetic::sbb;
+
+    uint64_t borrow = 0;
+    std::array<uint64_t, Fq::WIDTH> d{};
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        d[i] = sbb(Fq::MODULUS_LIMBS[i], this->data[i], borrow);
+
+    // zero has to stay zero rather than become MODULUS
+    const uint64_t mask = static_cast<uint64_t>(this->is_zero()) - 1;
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        d[i] &= mask;
+    return Fq{d};
+}
+
+inline Fq &Fq::operator+=(const Fq &rhs) {
+    using arithmetic::adc;
+
+    uint64_t carry = 0;
+    std::array<uint64_t, Fq::WIDTH> d{};
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        d[i] = adc(this->data[i], rhs.data[i], carry);
+
+    *this = Fq::subtract_modulus(d);
+    return *this;
+}
+
+inline Fq &Fq::operator-=(const Fq &rhs) {
+    using arithmetic::adc;
+    using arithmetic::sbb;
+
+    uint64_t borrow = 0;
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        this->data[i] = sbb(this->data[i], rhs.data[i], borrow);
+
+    uint64_t carry = 0;
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        this->data[i] = adc(this->data[i], Fq::MODULUS_LIMBS[i] & borrow, carry);
+    return *this;
+}
+
+inline Fq Fq::add_lazy(const Fq &rhs) const {
+    using arithmetic::adc;
+
+    uint64_t carry = 0;
+    std::array<uint64_t, Fq::WIDTH> d{};
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        d[i] = adc(this->data[i], rhs.data[i], carry);
+    return Fq{d};
+}
+
+inline Fq Fq::sub_lazy(const Fq &rhs) const {
+    using arithmetic::adc;
+    using arithmetic::sbb;
+
+    // this + MODULUS - rhs, where a wrapped difference is undone by the addition
+    uint64_t borrow = 0;
+    std::array<uint64_t, Fq::WIDTH> d{};
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        d[i] = sbb(this->data[i], rhs.data[i], borrow);
+
+    uint64_t carry = 0;
+    for (int i = 0; i < Fq::WIDTH; ++i)
+        d[i] = adc(d[i], Fq::MODULUS_LIMBS[i], carry);
+    return Fq{d};
+}
+
+inline Fq Fq::mul_lazy(const Fq &rhs) const {
+    // the CIOS rounds take their multiplier limbs from `rhs`, so any 256-bit value there keeps the result below
+    // this + MODULUS
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+    if (montgomery::active() == montgomery::Backend::MULX_ADX)
+        return Fq{montgomery::mulx_adx::mul(this->data, rhs.data, Fq::MODULUS_LIMBS, Fq::INV)};
+#endif
+    return Fq{montgomery::portable::mul(this->data, rhs.data, Fq::MODULUS_LIMBS, Fq::INV)};
+}
+
+inline Fq &Fq::operator*=(const Fq &rhs) {
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+    if (montgomery::active() == montgomery::Backend::MULX_ADX) {
+        *this = Fq::subtract_modulus(montgomery::mulx_adx::mul(this->data, rhs.data, Fq::MODULUS_LIMBS, Fq::INV));
+        return *this;
+    }
+#endif
+    *this = Fq::subtract_modulus(montgomery::portable::mul(this->data, rhs.data, Fq::MODULUS_LIMBS, Fq::INV));
+    return *this;
+}
+
+} // namespace jubjub::field
+
+#endif //JUBJUB_FQ_H
\ No newline at end of file
@@ -2,12 +2,18 @@
 #define JUBJUB_FR_H
 
 #include <array>
+#include <concepts>
 #include <cstdint>
 #include <optional>
+#include <span>
+#include <string_view>
 
 #include "core/rng.h"
 #include "scalar/scalar.h"
 
+#include "field/arithmetic.h"
+#include "field/montgomery.h"
+
 namespace jubjub::group { class Extended; }
 
 namespace jubjub::field {
@@ -17,22 +23,39 @@ public:
     static constexpr int32_t WIDTH = 4;
     static constexpr int32_t BYTE_SIZE = Fr::WIDTH * sizeof(uint64_t);
 
+    enum class Inversion : uint8_t {
+        ADDITION_CHAIN,
+        SAFEGCD,
+    };
+
+    static constexpr std::array<uint64_t, Fr::WIDTH> MODULUS_LIMBS = {
+            0xd0970e5ed6f72cb7, 0xa6682093ccc81082,
+            0x06673b0101343b00, 0x0e7db4ea6533afa9,
+    };
+    static constexpr uint64_t INV = 0x1ba3a358ef788ef9;
+
 private:
     std::array<uint64_t, Fr::WIDTH> data;
 
 public:
-    Fr();
-    Fr(const Fr &fr);
+    constexpr Fr() : data{0} {}
+    constexpr Fr(const Fr &fr) = default;
     explicit Fr(int8_t value);
-    explicit Fr(uint64_t value);
-    explicit Fr(const std::array<uint64_t, Fr::WIDTH> &data);
+    constexpr explicit Fr(const std::array<uint64_t, Fr::WIDTH> &data) : data{data} {}
+
+    template<std::unsigned_integral T>
+    explicit Fr(T value) : Fr(Fr::from_raw({static_cast<uint64_t>(value), 0, 0, 0})) {}
+    /// Wider signed values would be narrowed to `int8_t` silently, so they are rejected at compile time.
+    template<std::signed_integral T> requires (!std::same_as<T, int8_t>)
+    Fr(T value) = delete;
 
-    Fr(Fr &&fr) noexcept;
-    explicit Fr(std::array<uint64_t, Fr::WIDTH> &&data) noexcept;
+    constexpr Fr(Fr &&fr) noexcept = default;
+    constexpr explicit Fr(std::array<uint64_t, Fr::WIDTH> &&data) noexcept: data{data} {}
 
-    static Fr zero() noexcept;
+    static constexpr Fr zero() noexcept { return Fr{}; }
     static Fr one() noexcept;
     static Fr random(rng::core::RngCore &rng);
+    static void random_batch(rng::core::RngCore &rng, std::span<Fr> out);
 
     static Fr from_raw(const std::array<uint64_t, Fr::WIDTH> &values);
     static Fr montgomery_reduce(const std::array<uint64_t, Fr::WIDTH * 2> &ts);
@@ -40,6 +63,28 @@ public:
 
     static std::optional<Fr> from_bytes(const std::array<uint8_t, Fr::BYTE_SIZE> &bytes);
 
+    /// Reduces the BLAKE2b-512 digest of `message`, personalized with `domain`. A domain longer than 16 bytes throws
+    /// `std::invalid_argument`.
+    static Fr hash_to_scalar(std::string_view domain, std::span<const uint8_t> message);
+    static void hash_to_scalar_batch(std::string_view domain, std::span<const std::span<const uint8_t>> messages,
+                                     std::span<Fr> out);
+
+    static size_t decode_batch(std::span<const uint8_t> bytes, std::span<Fr> out);
+    static void encode_batch(std::span<const Fr> values, std::span<uint8_t> out);
+    static void from_u64_batch(std::span<const uint64_t> values, std::span<Fr> out);
+
+    static void to_bls_scalar_batch(std::span<const Fr> values, std::span<bls12_381::scalar::Scalar> out);
+
+    static Fr conditional_select(const Fr &a, const Fr &b, bool choice);
+
+    static void batch_invert(std::span<Fr> values);
+    static void batch_invert(std::span<Fr> values, uint32_t threads);
+
+    static Fr sum(std::span<const Fr> values);
+    static Fr sum_of_products(std::span<const Fr> a, std::span<const Fr> b);
+
+    static Fr multi_pow_vartime(std::span<const Fr> bases, std::span<const std::array<uint64_t, Fr::WIDTH>> exps);
+
     [[nodiscard]] bool is_even() const;
     [[nodiscard]] bool is_zero() const;
     [[nodiscard]] std::optional<bls12_381::scalar::Scalar> to_bls_scalar() const;
@@ -49,23 +94,31 @@ public:
     [[nodiscard]] Fr square() const;
     [[nodiscard]] Fr self_reduce() const;
     [[nodiscard]] Fr pow(const std::array<uint64_t, Fr::WIDTH> &exp) const;
+    [[nodiscard]] Fr pow_vartime(const std::array<uint64_t, Fr::WIDTH> &exp) const;
 
     void div_n(uint32_t n);
 
     [[nodiscard]] std::optional<Fr> sqrt() const;
-    [[nodiscard]] std::optional< Fr> invert() const;
+    [[nodiscard]] int8_t legendre() const;
+    [[nodiscard]] bool is_square() const;
+    [[nodiscard]] std::optional<Fr> invert(Inversion method = Inversion::SAFEGCD) const;
 
     [[nodiscard]] uint8_t mod_2_pow_k(uint8_t k) const;
     [[nodiscard]] int8_t mod_k(uint8_t w) const;
     [[nodiscard]] std::array<int8_t, 256> compute_windowed_non_adjacent(uint8_t width) const;
 
+    size_t wnaf(uint8_t width, std::span<int8_t, 256> digits) const;
+    size_t radix_2w(uint8_t width, std::span<int8_t, 256> digits) const;
+
 private:
     static Fr reduce(const std::array<uint64_t, Fr::WIDTH * 2> &limbs);
+    static Fr subtract_modulus(const std::array<uint64_t, Fr::WIDTH> &limbs);
+    static void mul_batch(std::span<Fr> values, const Fr &factor);
 
 public:
     Fr operator-() const;
-    Fr &operator=(const Fr &rhs);
-    Fr &operator=(Fr &&rhs) noexcept;
+    constexpr Fr &operator=(const Fr &rhs) = default;
+    constexpr Fr &operator=(Fr &&rhs) noexcept = default;
 
     Fr &operator+=(const Fr &rhs);
     Fr &operator-=(const Fr &rhs);
@@ -78,12 +131,96 @@ public:
     friend inline Fr operator-(const Fr &lhs, const Fr &rhs) { return Fr(lhs) -= rhs; }
     friend inline Fr operator*(const Fr &lhs, const Fr &rhs) { return Fr(lhs) *= rhs; }
 
-    friend inline bool operator==(const Fr &lhs, const Fr &rhs) { return lhs.data == rhs.data; }
-    friend inline bool operator!=(const Fr &lhs, const Fr &rhs) { return lhs.data != rhs.data; }
+    friend constexpr bool operator==(const Fr &lhs, const Fr &rhs) { return lhs.data == rhs.data; }
+    friend constexpr bool operator!=(const Fr &lhs, const Fr &rhs) { return lhs.data != rhs.data; }
 
     friend group::Extended operator*(const Fr &lhs, const group::Extended &rhs);
+
+    friend class FrVec;
 };
 
+inline Fr Fr::subtract_modulus(const std::array<uint64_t, Fr::WIDTH> &limbs) {
+    using arithmetic::sbb;
+
+    uint64_t borrow = 0;
+    std::array<uint64_t, Fr::WIDTH> d{};
+    for (int i = 0; i < Fr::WIDTH; ++i)
+        d[i] = sbb(limbs[i], Fr::MODULUS_LIMBS[i], borrow);
+
+    // keep the original limbs when the subtraction underflowed, without branching on the value
+    for (int i = 0; i < Fr::WIDTH; ++i)
+        d[i] = (limbs[i] & borrow) | (d[i] & ~borrow);
+    return Fr{d};
+}
+
+inline Fr Fr::montgomery_reduce(const std::array<uint64_t, Fr::WIDTH * 2> &ts) {
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+    if (montgomery::active() == montgomery::Backend::MULX_ADX)
+        return Fr::subtract_modulus(montgomery::mulx_adx::reduce(ts, Fr::MODULUS_LIMBS, Fr::INV));
+#endif
+    return Fr::subtract_modulus(montgomery::portable::reduce(ts, Fr::MODULUS_LIMBS, Fr::INV));
+}
+
+inline Fr Fr::square() const {
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+    if (montgomery::active() == montgomery::Backend::MULX_ADX)
+        return Fr::subtract_modulus(montgomery::mulx_adx::square(this->data, Fr::MODULUS_LIMBS, Fr::INV));
+#endif
+    return Fr::subtract_modulus(montgomery::portable::square(this->data, Fr::MODULUS_LIMBS, Fr::INV));
+}
+
+inline Fr Fr::operator-() const {
+    using arithmetic::sbb;
+
+    uint64_t borrow = 0;
+    std::array<uint64_t, Fr::WIDTH> d{};
+    for (int i = 0; i < Fr::WIDTH; ++i)
+        d[i] = sbb(Fr::MODULUS_LIMBS[i], this->data[i], borrow);
+
+    const bool dec = (this->data[0] | this->data[1] | this->data[2] | this->data[3]) == 0;
+    const uint64_t mask = static_cast<uint64_t>(dec) - 1;
+    for (int i = 0; i < Fr::WIDTH; ++i)
+        d[i] &= mask;
+    return Fr{d};
+}
+
+inline Fr &Fr::operator+=(const Fr &rhs) {
+    using arithmetic::adc;
+
+    uint64_t carry = 0;
+    std::array<uint64_t, Fr::WIDTH> d{};
+    for (int i = 0; i < Fr::WIDTH; ++i)
+        d[i] = adc(this->data[i], rhs.data[i], carry);
+
+    *this = Fr::subtract_modulus(d);
+    return *this;
+}
+
+inline Fr &Fr::operator-=(const Fr &rhs) {
+    using arithmetic::adc;
+    using arithmetic::sbb;
+
+    uint64_t borrow = 0;
+    for (int i = 0; i < Fr::WIDTH; ++i)
+        this->data[i] = sbb(this->data[i], rhs.data[i], borrow);
+
+    uint64_t carry = 0;
+    for (int i = 0; i < Fr::WIDTH; ++i)
+        this->data[i] = adc(this->data[i], Fr::MODULUS_LIMBS[i] & borrow, carry);
+    return *this;
+}
+
+inline Fr &Fr::operator*=(const Fr &rhs) {
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+    if (montgomery::active() == montgomery::Backend::MULX_ADX) {
+        *this = Fr::subtract_modulus(montgomery::mulx_adx::mul(this->data, rhs.data, Fr::MODULUS_LIMBS, Fr::INV));
+        return *this;
+    }
+#endif
+    *this = Fr::subtract_modulus(montgomery::portable::mul(this->data, rhs.data, Fr::MODULUS_LIMBS, Fr::INV));
+    return *this;
+}
+
 } // namespace jubjub::field
 
 #endif //JUBJUB_FR_H
\ No newline at end of file
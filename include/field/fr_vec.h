@@ -0,0 +1,101 @@
+#ifndef JUBJUB_FR_VEC_H
+#define JUBJUB_FR_VEC_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "field/fr.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(JUBJUB_NO_SIMD)
+#define JUBJUB_FR_VEC_X86 1
+#endif
+
+namespace jubjub::field {
+
+/// A vector of `Fr` elements stored limb-major ("structure of arrays"), so that the same operation can be
+/// applied to several elements at once.
+///
+/// Elements stay in the Montgomery form used by `Fr`, limb `k` of every element being stored contiguously.
+/// The storage is padded with zeros to a multiple of `FrVec::LANES`, which lets the kernels work on full
+/// vectors only. Binary operations require both operands to have the same size.
+class FrVec {
+public:
+    static constexpr size_t LANES = 8;
+
+    /// Below `MIN_SIZE` elements the conversions to and from the limb-major layout cost more than the kernels
+    /// save; batch callers convert at most `CHUNK_SIZE` elements at a time to keep them in cache.
+    static constexpr size_t MIN_SIZE = 32;
+    static constexpr size_t CHUNK_SIZE = 1024;
+
+    enum class Backend : uint8_t {
+        PORTABLE,
+        AVX2,
+        AVX512_IFMA,
+    };
+
+    enum class Op : uint8_t {
+        ADD,
+        SUB,
+        MUL,
+        SQUARE,
+    };
+
+private:
+    size_t length;
+    size_t stride;
+    std::vector<uint64_t> limbs;
+
+public:
+    FrVec() : length{0}, stride{0} {}
+    explicit FrVec(size_t size);
+    FrVec(size_t size, const Fr &value);
+    explicit FrVec(std::span<const Fr> values);
+
+    static Backend detect() noexcept;
+    static bool is_supported(Backend backend) noexcept;
+
+    static Backend active() noexcept {
+        static const Backend backend = FrVec::detect();
+        return backend;
+    }
+
+    /// Whether a batch of `size` elements is worth moving into an `FrVec`.
+    static bool pays_off(size_t size) noexcept {
+        return FrVec::active() != Backend::PORTABLE && size >= FrVec::MIN_SIZE;
+    }
+
+    static void add(FrVec &out, const FrVec &lhs, const FrVec &rhs, Backend backend = FrVec::active());
+    static void sub(FrVec &out, const FrVec &lhs, const FrVec &rhs, Backend backend = FrVec::active());
+    static void mul(FrVec &out, const FrVec &lhs, const FrVec &rhs, Backend backend = FrVec::active());
+    static void square(FrVec &out, const FrVec &value, Backend backend = FrVec::active());
+
+    [[nodiscard]] size_t size() const noexcept { return this->length; }
+    [[nodiscard]] bool empty() const noexcept { return this->length == 0; }
+
+    [[nodiscard]] Fr get(size_t index) const;
+    void set(size_t index, const Fr &value);
+
+    [[nodiscard]] std::vector<Fr> to_vector() const;
+
+    [[nodiscard]] FrVec square() const;
+
+private:
+    static void apply(Op op, FrVec &out, const FrVec &lhs, const FrVec &rhs, Backend backend);
+
+    [[nodiscard]] const uint64_t *column(size_t k) const { return this->limbs.data() + k * this->stride; }
+    [[nodiscard]] uint64_t *column(size_t k) { return this->limbs.data() + k * this->stride; }
+
+public:
+    FrVec &operator+=(const FrVec &rhs);
+    FrVec &operator-=(const FrVec &rhs);
+    FrVec &operator*=(const FrVec &rhs);
+
+    friend inline FrVec operator+(const FrVec &lhs, const FrVec &rhs) { return FrVec(lhs) += rhs; }
+    friend inline FrVec operator-(const FrVec &lhs, const FrVec &rhs) { return FrVec(lhs) -= rhs; }
+    friend inline FrVec operator*(const FrVec &lhs, const FrVec &rhs) { return FrVec(lhs) *= rhs; }
+};
+
+} // namespace jubjub::field
+
+#endif //JUBJUB_FR_VEC_H
\ No newline at end of file
@@ -0,0 +1,381 @@
+#ifndef JUBJUB_FIELD_MONTGOMERY_H
+#define JUBJUB_FIELD_MONTGOMERY_H
+
+#include <array>
+#include <cstdint>
+
+#include "field/arithmetic.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(JUBJUB_NO_ASM)
+#define JUBJUB_MONTGOMERY_MULX_ADX 1
+#endif
+
+/// Unrolled 4-limb Montgomery kernels shared by the field types.
+///
+/// All kernels expect a modulus whose top limb leaves at least one spare bit (the "no-carry" condition),
+/// which holds for both the Jubjub and the BLS12-381 scalar fields, and return values in `[0, 2 * modulus)`
+/// that the caller reduces with a single conditional subtraction.
+namespace jubjub::field::montgomery {
+
+using Limbs = std::array<uint64_t, 4>;
+using WideLimbs = std::array<uint64_t, 8>;
+
+enum class Backend : uint8_t {
+    PORTABLE,
+    MULX_ADX,
+};
+
+Backend detect() noexcept;
+
+inline Backend active() noexcept {
+    static const Backend backend = detect();
+    return backend;
+}
+
+/// Computes `2^exponent mod modulus` by repeated doubling, for checking the Montgomery constants at compile time.
+constexpr Limbs pow2_mod(const Limbs &modulus, uint32_t exponent) {
+    using arithmetic::sbb;
+
+    Limbs r = {1, 0, 0, 0};
+    for (uint32_t i = 0; i < exponent; ++i) {
+        // the no-carry condition keeps 2 * r below 2^256
+        r = {r[0] << 1, (r[1] << 1) | (r[0] >> 63), (r[2] << 1) | (r[1] >> 63), (r[3] << 1) | (r[2] >> 63)};
+
+        uint64_t borrow = 0;
+        Limbs d{};
+        for (int j = 0; j < 4; ++j)
+            d[j] = sbb(r[j], modulus[j], borrow);
+        if (borrow == 0) r = d;
+    }
+    return r;
+}
+
+/// Computes `-modulus^-1 mod 2^64` for an odd modulus.
+constexpr uint64_t neg_inverse(const Limbs &modulus) {
+    // Newton iteration, every step doubles the number of correct bits
+    uint64_t inv = 1;
+    for (int i = 0; i < 6; ++i)
+        inv *= 2 - modulus[0] * inv;
+    return 0 - inv;
+}
+
+namespace portable {
+
+/// One CIOS round: `t = (t + x * y + m * modulus) / 2^64`.
+inline void mul_round(Limbs &t, const Limbs &x, uint64_t y, const Limbs &modulus, uint64_t inv) {
+    using arithmetic::mac;
+
+    uint64_t a = 0;
+    t[0] = mac(t[0], x[0], y, a);
+    t[1] = mac(t[1], x[1], y, a);
+    t[2] = mac(t[2], x[2], y, a);
+    t[3] = mac(t[3], x[3], y, a);
+
+    const uint64_t m = t[0] * inv;
+    uint64_t c = 0;
+    mac(t[0], m, modulus[0], c);
+    t[0] = mac(t[1], m, modulus[1], c);
+    t[1] = mac(t[2], m, modulus[2], c);
+    t[2] = mac(t[3], m, modulus[3], c);
+    t[3] = c + a;
+}
+
+/// One REDC round eliminating limb `I` of `t`, deferring the carry out of limb `I + 4` into `carry`.
+template<int I>
+inline void reduce_round(WideLimbs &t, uint64_t &carry, const Limbs &modulus, uint64_t inv) {
+    using arithmetic::adc;
+    using arithmetic::mac;
+
+    const uint64_t m = t[I] * inv;
+    uint64_t c = 0;
+    mac(t[I], m, modulus[0], c);
+    t[I + 1] = mac(t[I + 1], m, modulus[1], c);
+    t[I + 2] = mac(t[I + 2], m, modulus[2], c);
+    t[I + 3] = mac(t[I + 3], m, modulus[3], c);
+    t[I + 4] = adc(t[I + 4], carry, c);
+    carry = c;
+}
+
+inline Limbs reduce(WideLimbs t, const Limbs &modulus, uint64_t inv) {
+    uint64_t carry = 0;
+    reduce_round<0>(t, carry, modulus, inv);
+    reduce_round<1>(t, carry, modulus, inv);
+    reduce_round<2>(t, carry, modulus, inv);
+    reduce_round<3>(t, carry, modulus, inv);
+    return {t[4], t[5], t[6], t[7]};
+}
+
+/// REDC of any 512-bit value, including those above `modulus * 2^256`: the result is below `2^256 + modulus`,
+/// and its bit 256 is returned in `carry`.
+inline Limbs reduce_wide(WideLimbs t, const Limbs &modulus, uint64_t inv, uint64_t &carry) {
+    carry = 0;
+    reduce_round<0>(t, carry, modulus, inv);
+    reduce_round<1>(t, carry, modulus, inv);
+    reduce_round<2>(t, carry, modulus, inv);
+    reduce_round<3>(t, carry, modulus, inv);
+    return {t[4], t[5], t[6], t[7]};
+}
+
+inline Limbs mul(const Limbs &x, const Limbs &y, const Limbs &modulus, uint64_t inv) {
+    Limbs t{0, 0, 0, 0};
+    mul_round(t, x, y[0], modulus, inv);
+    mul_round(t, x, y[1], modulus, inv);
+    mul_round(t, x, y[2], modulus, inv);
+    mul_round(t, x, y[3], modulus, inv);
+    return t;
+}
+
+inline Limbs square(const Limbs &x, const Limbs &modulus, uint64_t inv) {
+    using arithmetic::adc;
+    using arithmetic::mac;
+
+    WideLimbs r{};
+    uint64_t carry = 0;
+    r[1] = mac(0, x[0], x[1], carry);
+    r[2] = mac(0, x[0], x[2], carry);
+    r[3] = mac(0, x[0], x[3], carry);
+    r[4] = carry;
+
+    carry = 0;
+    r[3] = mac(r[3], x[1], x[2], carry);
+    r[4] = mac(r[4], x[1], x[3], carry);
+    r[5] = carry;
+
+    carry = 0;
+    r[5] = mac(r[5], x[2], x[3], carry);
+    r[6] = carry;
+
+    r[7] = r[6] >> 63;
+    r[6] = (r[6] << 1) | (r[5] >> 63);
+    r[5] = (r[5] << 1) | (r[4] >> 63);
+    r[4] = (r[4] << 1) | (r[3] >> 63);
+    r[3] = (r[3] << 1) | (r[2] >> 63);
+    r[2] = (r[2] << 1) | (r[1] >> 63);
+    r[1] = r[1] << 1;
+
+    carry = 0;
+    r[0] = mac(0, x[0], x[0], carry);
+    r[1] = adc(r[1], 0, carry);
+    r[2] = mac(r[2], x[1], x[1], carry);
+    r[3] = adc(r[3], 0, carry);
+    r[4] = mac(r[4], x[2], x[2], carry);
+    r[5] = adc(r[5], 0, carry);
+    r[6] = mac(r[6], x[3], x[3], carry);
+    r[7] = adc(r[7], 0, carry);
+
+    return reduce(r, modulus, inv);
+}
+
+/// Adds the full product `x * y` to `acc` without reducing, for callers that defer the REDC over several
+/// products. The caller keeps the sum below 2^512.
+inline void mul_add_wide(WideLimbs &acc, const Limbs &x, const Limbs &y) {
+    using arithmetic::adc;
+
+    // product scanning: the partial products of a column are independent, and only the column sum carries
+    WideLimbs r{};
+    unsigned __int128 column = 0;
+    for (int k = 0; k < 7; ++k) {
+        uint64_t overflow = 0;
+        for (int i = k < 4 ? 0 : k - 3; i <= (k < 4 ? k : 3); ++i) {
+            const unsigned __int128 product = static_cast<unsigned __int128>(x[i]) * y[k - i];
+            column += product;
+            overflow += column < product;
+        }
+        r[k] = static_cast<uint64_t>(column);
+        column = (column >> 64) | (static_cast<unsigned __int128>(overflow) << 64);
+    }
+    r[7] = static_cast<uint64_t>(column);
+
+    uint64_t carry = 0;
+    for (int k = 0; k < 8; ++k)
+        acc[k] = adc(acc[k], r[k], carry);
+}
+
+} // namespace portable
+
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+
+/// MULX/ADCX/ADOX kernels, running two independent carry chains per round.
+///
+/// Callers must check `active() == Backend::MULX_ADX` (BMI2 and ADX present) before using them.
+namespace mulx_adx {
+
+/// One CIOS round: `t = (t + x * y + m * modulus) / 2^64`.
+inline void mul_round(Limbs &t, const Limbs &x, uint64_t y, const Limbs &modulus, uint64_t inv) {
+    uint64_t a, lo, hi;
+    __asm__(
+            "movq %[y], %%rdx\n\t"
+            "xorl %k[lo], %k[lo]\n\t"
+            "mulxq 0(%[x]), %[lo], %[hi]\n\t"
+            "adoxq %[lo], %[t0]\n\t"
+            "adcxq %[hi], %[t1]\n\t"
+            "mulxq 8(%[x]), %[lo], %[hi]\n\t"
+            "adoxq %[lo], %[t1]\n\t"
+            "adcxq %[hi], %[t2]\n\t"
+            "mulxq 16(%[x]), %[lo], %[hi]\n\t"
+            "adoxq %[lo], %[t2]\n\t"
+            "adcxq %[hi], %[t3]\n\t"
+            "mulxq 24(%[x]), %[lo], %[a]\n\t"
+            "adoxq %[lo], %[t3]\n\t"
+            "movl $0, %k[lo]\n\t"
+            "adcxq %[lo], %[a]\n\t"
+            "adoxq %[lo], %[a]\n\t"
+
+            "movq %[inv], %%rdx\n\t"
+            "imulq %[t0], %%rdx\n\t"
+            "xorl %k[lo], %k[lo]\n\t"
+            "mulxq 0(%[modulus]), %[lo], %[hi]\n\t"
+            "adcxq %[t0], %[lo]\n\t"
+            "movq %[hi], %[t0]\n\t"
+            "adcxq %[t1], %[t0]\n\t"
+            "mulxq 8(%[modulus]), %[lo], %[t1]\n\t"
+            "adoxq %[lo], %[t0]\n\t"
+            "adcxq %[t2], %[t1]\n\t"
+            "mulxq 16(%[modulus]), %[lo], %[t2]\n\t"
+            "adoxq %[lo], %[t1]\n\t"
+            "adcxq %[t3], %[t2]\n\t"
+            "mulxq 24(%[modulus]), %[lo], %[t3]\n\t"
+            "adoxq %[lo], %[t2]\n\t"
+            "movl $0, %k[lo]\n\t"
+            "adcxq %[lo], %[t3]\n\t"
+            "adoxq %[a], %[t3]\n\t"
+            : [t0] "+r"(t[0]), [t1] "+r"(t[1]), [t2] "+r"(t[2]), [t3] "+r"(t[3]),
+              [a] "=&r"(a), [lo] "=&r"(lo), [hi] "=&r"(hi)
+            : [y] "rm"(y), [x] "r"(x.data()), [modulus] "r"(modulus.data()), [inv] "rm"(inv),
+              "m"(x), "m"(modulus)
+            : "rdx", "cc"
+    );
+}
+
+/// One REDC round eliminating limb `I` of `t`, deferring the carry out of limb `I + 4` into `carry`.
+template<int I>
+inline void reduce_round(WideLimbs &t, uint64_t &carry, const Limbs &modulus, uint64_t inv) {
+    uint64_t lo, hi;
+    __asm__(
+            "movq %[inv], %%rdx\n\t"
+            "imulq %[t0], %%rdx\n\t"
+            "xorl %k[lo], %k[lo]\n\t"
+            "mulxq 0(%[modulus]), %[lo], %[hi]\n\t"
+            "adcxq %[lo], %[t0]\n\t"
+            "adoxq %[hi], %[t1]\n\t"
+            "mulxq 8(%[modulus]), %[lo], %[hi]\n\t"
+            "adcxq %[lo], %[t1]\n\t"
+            "adoxq %[hi], %[t2]\n\t"
+            "mulxq 16(%[modulus]), %[lo], %[hi]\n\t"
+            "adcxq %[lo], %[t2]\n\t"
+            "adoxq %[hi], %[t3]\n\t"
+            "mulxq 24(%[modulus]), %[lo], %[hi]\n\t"
+            "adcxq %[lo], %[t3]\n\t"
+            "adcxq %[hi], %[t4]\n\t"
+            "adoxq %[carry], %[t4]\n\t"
+            // t0 is zero once eliminated, so it doubles as the zero register for collecting both carries
+            "movl $0, %k[carry]\n\t"
+            "adcxq %[t0], %[carry]\n\t"
+            "adoxq %[t0], %[carry]\n\t"
+            : [t0] "+r"(t[I]), [t1] "+r"(t[I + 1]), [t2] "+r"(t[I + 2]), [t3] "+r"(t[I + 3]), [t4] "+r"(t[I + 4]),
+              [carry] "+r"(carry), [lo] "=&r"(lo), [hi] "=&r"(hi)
+            : [modulus] "r"(modulus.data()), [inv] "rm"(inv), "m"(modulus)
+            : "rdx", "cc"
+    );
+}
+
+inline Limbs reduce(WideLimbs t, const Limbs &modulus, uint64_t inv) {
+    uint64_t carry = 0;
+    reduce_round<0>(t, carry, modulus, inv);
+    reduce_round<1>(t, carry, modulus, inv);
+    reduce_round<2>(t, carry, modulus, inv);
+    reduce_round<3>(t, carry, modulus, inv);
+    return {t[4], t[5], t[6], t[7]};
+}
+
+/// REDC of any 512-bit value, including those above `modulus * 2^256`: the result is below `2^256 + modulus`,
+/// and its bit 256 is returned in `carry`.
+inline Limbs reduce_wide(WideLimbs t, const Limbs &modulus, uint64_t inv, uint64_t &carry) {
+    carry = 0;
+    reduce_round<0>(t, carry, modulus, inv);
+    reduce_round<1>(t, carry, modulus, inv);
+    reduce_round<2>(t, carry, modulus, inv);
+    reduce_round<3>(t, carry, modulus, inv);
+    return {t[4], t[5], t[6], t[7]};
+}
+
+inline Limbs mul(const Limbs &x, const Limbs &y, const Limbs &modulus, uint64_t inv) {
+    Limbs t{0, 0, 0, 0};
+    mul_round(t, x, y[0], modulus, inv);
+    mul_round(t, x, y[1], modulus, inv);
+    mul_round(t, x, y[2], modulus, inv);
+    mul_round(t, x, y[3], modulus, inv);
+    return t;
+}
+
+inline Limbs square(const Limbs &x, const Limbs &modulus, uint64_t inv) {
+    WideLimbs r{};
+    uint64_t lo, hi, zero;
+
+    // cross products x[i] * x[j] for i < j
+    __asm__(
+            "xorl %k[zero], %k[zero]\n\t"
+            "movq 0(%[x]), %%rdx\n\t"
+            "mulxq 8(%[x]), %[r1], %[r2]\n\t"
+            "mulxq 16(%[x]), %[lo], %[r3]\n\t"
+            "adcxq %[lo], %[r2]\n\t"
+            "mulxq 24(%[x]), %[lo], %[r4]\n\t"
+            "adcxq %[lo], %[r3]\n\t"
+            "movq 8(%[x]), %%rdx\n\t"
+            "mulxq 16(%[x]), %[lo], %[hi]\n\t"
+            "adoxq %[lo], %[r3]\n\t"
+            "adcxq %[hi], %[r4]\n\t"
+            "mulxq 24(%[x]), %[lo], %[r5]\n\t"
+            "adoxq %[lo], %[r4]\n\t"
+            "adcxq %[zero], %[r5]\n\t"
+            "movq 16(%[x]), %%rdx\n\t"
+            "mulxq 24(%[x]), %[lo], %[r6]\n\t"
+            "adoxq %[lo], %[r5]\n\t"
+            "adoxq %[zero], %[r6]\n\t"
+            : [r1] "=&r"(r[1]), [r2] "=&r"(r[2]), [r3] "=&r"(r[3]), [r4] "=&r"(r[4]), [r5] "=&r"(r[5]),
+              [r6] "=&r"(r[6]), [lo] "=&r"(lo), [hi] "=&r"(hi), [zero] "=&r"(zero)
+            : [x] "r"(x.data()), "m"(x)
+            : "rdx", "cc"
+    );
+
+    // double the cross products on the CF chain while adding the squares on the OF chain
+    __asm__(
+            "xorl %k[r7], %k[r7]\n\t"
+            "movq 0(%[x]), %%rdx\n\t"
+            "mulxq %%rdx, %[r0], %[hi]\n\t"
+            "adcxq %[r1], %[r1]\n\t"
+            "adoxq %[hi], %[r1]\n\t"
+            "movq 8(%[x]), %%rdx\n\t"
+            "mulxq %%rdx, %[lo], %[hi]\n\t"
+            "adcxq %[r2], %[r2]\n\t"
+            "adoxq %[lo], %[r2]\n\t"
+            "adcxq %[r3], %[r3]\n\t"
+            "adoxq %[hi], %[r3]\n\t"
+            "movq 16(%[x]), %%rdx\n\t"
+            "mulxq %%rdx, %[lo], %[hi]\n\t"
+            "adcxq %[r4], %[r4]\n\t"
+            "adoxq %[lo], %[r4]\n\t"
+            "adcxq %[r5], %[r5]\n\t"
+            "adoxq %[hi], %[r5]\n\t"
+            "movq 24(%[x]), %%rdx\n\t"
+            "mulxq %%rdx, %[lo], %[hi]\n\t"
+            "adcxq %[r6], %[r6]\n\t"
+            "adoxq %[lo], %[r6]\n\t"
+            "adcxq %[r7], %[r7]\n\t"
+            "adoxq %[hi], %[r7]\n\t"
+            : [r0] "=&r"(r[0]), [r1] "+r"(r[1]), [r2] "+r"(r[2]), [r3] "+r"(r[3]), [r4] "+r"(r[4]),
+              [r5] "+r"(r[5]), [r6] "+r"(r[6]), [r7] "=&r"(r[7]), [lo] "=&r"(lo), [hi] "=&r"(hi)
+            : [x] "r"(x.data()), "m"(x)
+            : "rdx", "cc"
+    );
+
+    return reduce(r, modulus, inv);
+}
+
+} // namespace mulx_adx
+
+#endif
+
+} // namespace jubjub::field::montgomery
+
+#endif //JUBJUB_FIELD_MONTGOMERY_H
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef JUBJUB_FIELD_RECODE_H
+#define JUBJUB_FIELD_RECODE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/// Signed-digit recodings of 256-bit little-endian integers, working directly on the limbs.
+///
+/// Both recodings expect the value to be below 2^255 so that the final carry fits in `MAX_DIGITS` digits.
+namespace jubjub::field::recode {
+
+constexpr size_t MAX_DIGITS = 256;
+
+/// Number of digits written by `radix_2w` for the given width.
+constexpr size_t radix_2w_length(uint8_t width) {
+    return (253 + width - 1) / width;
+}
+
+/// Computes the width-`width` non-adjacent form of `value`: every non-zero digit is odd, lies in
+/// `(-2^(width-1), 2^(width-1))`, and is followed by at least `width - 1` zeros.
+///
+/// Returns the number of digits up to and including the most significant non-zero one. Runs in variable time.
+size_t wnaf(const std::array<uint64_t, 4> &value, uint8_t width, std::span<int8_t, MAX_DIGITS> digits);
+
+/// Writes `value` as `sum(digits[i] * 2^(width * i))` with every digit in `[-2^(width-1), 2^(width-1)]`, for
+/// `width` in `[2, 8]` and `value` below 2^253.
+///
+/// Returns `radix_2w_length(width)`. Runs in constant time.
+size_t radix_2w(const std::array<uint64_t, 4> &value, uint8_t width, std::span<int8_t, MAX_DIGITS> digits);
+
+} // namespace jubjub::field::recode
+
+#endif //JUBJUB_FIELD_RECODE_H
\ No newline at end of file
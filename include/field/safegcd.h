@@ -0,0 +1,49 @@
+#ifndef JUBJUB_FIELD_SAFEGCD_H
+#define JUBJUB_FIELD_SAFEGCD_H
+
+#include <array>
+#include <cstdint>
+
+/// Constant-time modular inversion using the Bernstein-Yang "safegcd" divstep algorithm.
+///
+/// Values are handled as five signed 62-bit limbs; ten batches of 59 divsteps are enough for any modulus
+/// below 2^256. The implementation follows the `modinv64` module of libsecp256k1.
+namespace jubjub::field::safegcd {
+
+struct Signed62 {
+    std::array<int64_t, 5> v;
+};
+
+constexpr uint64_t M62 = UINT64_MAX >> 2;
+
+constexpr Signed62 to_signed62(const std::array<uint64_t, 4> &limbs) {
+    return Signed62{
+            {
+                    static_cast<int64_t>(limbs[0] & M62),
+                    static_cast<int64_t>(((limbs[0] >> 62) | (limbs[1] << 2)) & M62),
+                    static_cast<int64_t>(((limbs[1] >> 60) | (limbs[2] << 4)) & M62),
+                    static_cast<int64_t>(((limbs[2] >> 58) | (limbs[3] << 6)) & M62),
+                    static_cast<int64_t>(limbs[3] >> 56),
+            }
+    };
+}
+
+struct Modulus {
+    Signed62 modulus;
+    uint64_t modulus_inv62;
+
+    static constexpr Modulus from_limbs(const std::array<uint64_t, 4> &limbs) {
+        // Newton iteration for the inverse modulo 2^64, every step doubles the number of correct bits
+        uint64_t inv = 1;
+        for (int i = 0; i < 6; ++i)
+            inv *= 2 - limbs[0] * inv;
+        return Modulus{to_signed62(limbs), inv & M62};
+    }
+};
+
+/// Returns `value^-1 mod modulus` for `value` in `[0, modulus)`, or zero when `value` is zero.
+std::array<uint64_t, 4> invert(const std::array<uint64_t, 4> &value, const Modulus &modulus);
+
+} // namespace jubjub::field::safegcd
+
+#endif //JUBJUB_FIELD_SAFEGCD_H
\ No newline at end of file
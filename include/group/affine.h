@@ -2,9 +2,13 @@
 #define JUBJUB_AFFINE_H
 
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "scalar/scalar.h"
 
+#include "field/fq.h"
+
 namespace jubjub::group {
 
 class AffineNiels;
@@ -12,8 +16,12 @@ class Extended;
 
 class Affine {
 private:
-    bls12_381::scalar::Scalar x;
-    bls12_381::scalar::Scalar y;
+    field::Fq x;
+    field::Fq y;
+
+    friend class AffineNiels;
+    friend class Extended;
+    friend auto batch_normalize(std::vector<Extended> &y) -> std::vector<Affine>;
 
 public:
     Affine();
@@ -22,6 +30,8 @@ public:
 
     explicit Affine(const Extended &extended);
 
+    constexpr Affine(field::Fq x, field::Fq y) : x{std::move(x)}, y{std::move(y)} {}
+
     Affine(bls12_381::scalar::Scalar x, bls12_381::scalar::Scalar y);
 
     static Affine identity() noexcept;
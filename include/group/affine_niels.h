@@ -5,6 +5,8 @@
 
 #include "scalar/scalar.h"
 
+#include "field/fq.h"
+
 namespace jubjub::field { class Fr; }
 
 namespace jubjub::group {
@@ -14,9 +16,13 @@ class Extended;
 
 class AffineNiels {
 private:
-    bls12_381::scalar::Scalar y_plus_x;
-    bls12_381::scalar::Scalar y_minus_x;
-    bls12_381::scalar::Scalar t2d;
+    field::Fq y_plus_x;
+    field::Fq y_minus_x;
+    field::Fq t2d;
+
+    AffineNiels(field::Fq y_plus_x, field::Fq y_minus_x, field::Fq t2d);
+
+    friend class Extended;
 
 public:
     AffineNiels();
@@ -27,12 +33,19 @@ public:
 
     static AffineNiels identity() noexcept;
 
+    static AffineNiels conditional_select(const AffineNiels &a, const AffineNiels &b, bool choice);
+
     [[nodiscard]] Extended multiply(const std::array<uint8_t, 32> &by) const;
 
     [[nodiscard]] bls12_381::scalar::Scalar get_y_plus_x() const;
     [[nodiscard]] bls12_381::scalar::Scalar get_y_minus_x() const;
     [[nodiscard]] bls12_381::scalar::Scalar get_t2d() const;
 
+public:
+    AffineNiels operator-() const;
+    AffineNiels &operator=(const AffineNiels &rhs);
+    AffineNiels &operator=(AffineNiels &&rhs) noexcept;
+
 public:
     friend Extended operator+(const AffineNiels &lhs, const Extended &rhs);
     friend Extended operator-(const AffineNiels &lhs, const Extended &rhs);
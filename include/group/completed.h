@@ -1,15 +1,16 @@
 #ifndef JUBJUB_COMPLETED_H
 #define JUBJUB_COMPLETED_H
 
-#include "scalar/scalar.h"
+#include "field/fq.h"
 
 namespace jubjub::group {
 
+/// The point `((x : z), (y : t))` produced by the addition and doubling formulas, `t` may be redundant.
 struct Completed {
-    bls12_381::scalar::Scalar x;
-    bls12_381::scalar::Scalar y;
-    bls12_381::scalar::Scalar z;
-    bls12_381::scalar::Scalar t;
+    field::Fq x;
+    field::Fq y;
+    field::Fq z;
+    field::Fq t;
 };
 
 } // namespace jubjub::group
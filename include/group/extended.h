@@ -3,9 +3,13 @@
 
 #include <array>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "scalar/scalar.h"
 
+#include "field/fq.h"
+
 namespace jubjub::field { class Fr; }
 
 namespace jubjub::group {
@@ -14,15 +18,24 @@ class Affine;
 class AffineNiels;
 class Completed;
 class ExtendedNiels;
+class Projective;
 
 class Extended {
 private:
-    bls12_381::scalar::Scalar x;
-    bls12_381::scalar::Scalar y;
-    bls12_381::scalar::Scalar z;
+    field::Fq x;
+    field::Fq y;
+    field::Fq z;
+
+    field::Fq t1;
+    field::Fq t2;
+
+    /// Sets this point to the completed point `((e : g), (h : f))`, where only `f` may be redundant.
+    Extended &assign_completed(const field::Fq &e, const field::Fq &f, const field::Fq &g, const field::Fq &h);
 
-    bls12_381::scalar::Scalar t1;
-    bls12_381::scalar::Scalar t2;
+    friend class Affine;
+    friend class ExtendedNiels;
+    friend class Projective;
+    friend auto batch_normalize(std::vector<Extended> &y) -> std::vector<Affine>;
 
 public:
     Extended();
@@ -33,6 +46,9 @@ public:
     explicit Extended(Affine &&affine) noexcept;
     explicit Extended(const Completed &completed);
 
+    constexpr Extended(field::Fq x, field::Fq y, field::Fq z, field::Fq t1, field::Fq t2)
+            : x{std::move(x)}, y{std::move(y)}, z{std::move(z)}, t1{std::move(t1)}, t2{std::move(t2)} {}
+
     Extended(bls12_381::scalar::Scalar x, bls12_381::scalar::Scalar y, bls12_381::scalar::Scalar z,
              bls12_381::scalar::Scalar t1, bls12_381::scalar::Scalar t2);
 
@@ -49,8 +65,20 @@ public:
 
     [[nodiscard]] Extended mul_by_cofactor() const;
     [[nodiscard]] Extended doubles() const;
+    /// Doubles `k` times, keeping the intermediate points projective so that only the last one carries `T`.
+    [[nodiscard]] Extended double_n(uint32_t k) const;
     [[nodiscard]] Extended multiply(const std::array<uint8_t, 32> &by) const;
 
+    /// Variable-time multiplications, leaking the scalar through timing: for public scalars only.
+    [[nodiscard]] Extended multiply_vartime(const field::Fr &by) const;
+    [[nodiscard]] Extended multiply_vartime(const std::array<uint8_t, 32> &by) const;
+
+    /// Returns `a * p + b * q` for about the doublings of a single multiplication. The first runs in constant time,
+    /// the second leaks both scalars through timing.
+    static Extended double_scalar_mul(const field::Fr &a, const Extended &p, const field::Fr &b, const Extended &q);
+    static Extended double_scalar_mul_vartime(const field::Fr &a, const Extended &p, const field::Fr &b,
+                                              const Extended &q);
+
     [[nodiscard]] bls12_381::scalar::Scalar get_x() const;
     [[nodiscard]] bls12_381::scalar::Scalar get_y() const;
     [[nodiscard]] bls12_381::scalar::Scalar get_z() const;
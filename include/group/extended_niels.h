@@ -1,8 +1,12 @@
 #ifndef JUBJUB_EXTENDED_NIELS_H
 #define JUBJUB_EXTENDED_NIELS_H
 
+#include <array>
+
 #include "scalar/scalar.h"
 
+#include "field/fq.h"
+
 namespace jubjub::field { class Fr; }
 
 namespace jubjub::group {
@@ -11,10 +15,14 @@ class Extended;
 
 class ExtendedNiels {
 private:
-    bls12_381::scalar::Scalar y_plus_x;
-    bls12_381::scalar::Scalar y_minus_x;
-    bls12_381::scalar::Scalar z;
-    bls12_381::scalar::Scalar t2d;
+    field::Fq y_plus_x;
+    field::Fq y_minus_x;
+    field::Fq z;
+    field::Fq t2d;
+
+    ExtendedNiels(field::Fq y_plus_x, field::Fq y_minus_x, field::Fq z, field::Fq t2d);
+
+    friend class Extended;
 
 public:
     ExtendedNiels();
@@ -26,6 +34,8 @@ public:
 
     static ExtendedNiels identity() noexcept;
 
+    static ExtendedNiels conditional_select(const ExtendedNiels &a, const ExtendedNiels &b, bool choice);
+
     [[nodiscard]] Extended multiply(const std::array<uint8_t, 32> &by) const;
 
     [[nodiscard]] bls12_381::scalar::Scalar get_y_plus_x() const;
@@ -33,6 +43,11 @@ public:
     [[nodiscard]] bls12_381::scalar::Scalar get_z() const;
     [[nodiscard]] bls12_381::scalar::Scalar get_t2d() const;
 
+public:
+    ExtendedNiels operator-() const;
+    ExtendedNiels &operator=(const ExtendedNiels &rhs);
+    ExtendedNiels &operator=(ExtendedNiels &&rhs) noexcept;
+
 public:
     friend Extended operator+(const ExtendedNiels &lhs, const Extended &rhs);
     friend Extended operator-(const ExtendedNiels &lhs, const Extended &rhs);
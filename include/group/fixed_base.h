@@ -0,0 +1,48 @@
+#ifndef JUBJUB_FIXED_BASE_H
+#define JUBJUB_FIXED_BASE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "field/recode.h"
+
+#include "group/affine_niels.h"
+#include "group/extended.h"
+#include "group/window.h"
+
+namespace jubjub::field { class Fr; }
+
+namespace jubjub::group {
+
+/// Precomputed multiples of a fixed base `B` for constant-time multiplication without doublings.
+///
+/// The scalar is recoded into `WINDOWS` signed radix-16 digits `d_i`, and `d_i * 16^i * B` is read from the
+/// `i`-th table of `[16^i * B, 2 * 16^i * B, ..., 8 * 16^i * B]`, so a multiplication costs `WINDOWS` mixed
+/// additions and `WINDOWS` masked lookups. The tables hold affine niels points and take about 48 KiB.
+class FixedBaseTable {
+public:
+    static constexpr size_t WINDOWS = field::recode::radix_2w_length(window::WIDTH);
+
+private:
+    std::vector<std::array<AffineNiels, window::TABLE_SIZE>> tables;
+
+public:
+    explicit FixedBaseTable(const Extended &base);
+
+    /// The tables of `constant::GENERATOR` and `constant::GENERATOR_NUMS`, built on first use.
+    static const FixedBaseTable &generator();
+    static const FixedBaseTable &generator_nums();
+
+    /// Returns the precomputed table of `base` if it is one of the generators, or `nullptr`.
+    static const FixedBaseTable *find(const Extended &base);
+
+    /// Returns `by * B`, reading the same low 252 bits of `by` as `Extended::multiply`. Runs in constant time.
+    [[nodiscard]] Extended multiply(const std::array<uint8_t, 32> &by) const;
+    [[nodiscard]] Extended multiply(const field::Fr &by) const;
+};
+
+} // namespace jubjub::group
+
+#endif //JUBJUB_FIXED_BASE_H
\ No newline at end of file
@@ -0,0 +1,109 @@
+#ifndef JUBJUB_FIXED_BASE_CACHE_H
+#define JUBJUB_FIXED_BASE_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "group/extended.h"
+#include "group/fixed_base.h"
+
+namespace jubjub::field { class Fr; }
+
+namespace jubjub::group {
+
+/// A bounded cache of `FixedBaseTable`s keyed by compressed point.
+///
+/// Lookups read an immutable snapshot of the index through an atomic pointer, guarded by a per-thread hazard
+/// pointer, so they take no lock and a hit writes no shared state beyond refreshing a stale timestamp. Misses,
+/// insertions and evictions are serialized by a writer mutex, publish a new snapshot and free the old ones no
+/// reader still guards. A point gets a table once it has missed `admission` times, which keeps one-off points
+/// from evicting hot ones, and the least recently used tables go first once the cache holds more than
+/// `max_bytes` of them. Recency is coarse: every use between two insertions gets the same timestamp.
+class FixedBaseCache {
+public:
+    using Key = std::array<uint8_t, 32>;
+
+    static constexpr size_t DEFAULT_MAX_BYTES = size_t{64} << 20;
+    static constexpr uint32_t DEFAULT_ADMISSION = 2;
+
+    /// Approximate memory held by one table.
+    static constexpr size_t TABLE_BYTES = sizeof(FixedBaseTable)
+                                          + FixedBaseTable::WINDOWS * window::TABLE_SIZE * sizeof(AffineNiels);
+
+private:
+    /// SipHash-1-3 under a per-cache random key, as public keys are chosen by whoever sends them.
+    struct KeyHash {
+        uint64_t k0;
+        uint64_t k1;
+
+        size_t operator()(const Key &key) const noexcept;
+    };
+
+    struct Entry {
+        std::shared_ptr<const FixedBaseTable> table;
+        mutable std::atomic<uint64_t> last_used;
+    };
+
+    using Index = std::unordered_map<Key, std::shared_ptr<Entry>, KeyHash>;
+
+    KeyHash hasher;
+    std::atomic<const Index *> index;
+    std::atomic<uint64_t> epoch;
+
+    mutable std::mutex writer;
+    std::vector<const Index *> retired;
+    std::unordered_map<Key, uint32_t, KeyHash> misses;
+    size_t max_bytes;
+    uint32_t admission;
+
+public:
+    explicit FixedBaseCache(size_t max_bytes = DEFAULT_MAX_BYTES, uint32_t admission = DEFAULT_ADMISSION);
+
+    ~FixedBaseCache();
+
+    FixedBaseCache(const FixedBaseCache &) = delete;
+    FixedBaseCache &operator=(const FixedBaseCache &) = delete;
+
+    /// A process-wide instance for callers that opt into sharing one, the library itself never uses it.
+    static FixedBaseCache &global();
+
+    /// Returns the table of `base`, counting a miss (and building the table once admitted) when it has none.
+    std::shared_ptr<const FixedBaseTable> get(const Extended &base);
+
+    /// Returns `by * base`, from the cached table when there is one. Runs in constant time in `by`.
+    Extended multiply(const Extended &base, const field::Fr &by);
+
+    /// Changes the memory cap, evicting tables right away if needed.
+    void set_max_bytes(size_t bytes);
+
+    [[nodiscard]] size_t get_max_bytes() const;
+    [[nodiscard]] size_t size() const;
+
+    void clear();
+
+private:
+    [[nodiscard]] size_t capacity() const { return this->max_bytes / FixedBaseCache::TABLE_BYTES; }
+
+    /// `get` for a `key` already derived from `base`; trusting an unrelated key would file `base`'s table under
+    /// another point, so only `get(base)` and `multiply`, which compress the point themselves, may call it.
+    std::shared_ptr<const FixedBaseTable> get(const Key &key, const Extended &base);
+
+    /// Returns the entry of `key` in the current snapshot after refreshing its timestamp, or null.
+    [[nodiscard]] const Entry *find(const Index &snapshot, const Key &key) const;
+
+    /// Drops the least recently used entries of `index` until it fits, while holding the writer mutex.
+    void evict(Index &index) const;
+
+    /// Publishes `next` and frees the snapshots no reader guards any more, while holding the writer mutex.
+    void publish(const Index *next);
+};
+
+} // namespace jubjub::group
+
+#endif //JUBJUB_FIXED_BASE_CACHE_H
\ No newline at end of file
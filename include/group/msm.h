@@ -0,0 +1,28 @@
+#ifndef JUBJUB_MSM_H
+#define JUBJUB_MSM_H
+
+#include <cstdint>
+#include <span>
+
+#include "group/affine.h"
+#include "group/extended.h"
+
+namespace jubjub::field { class Fr; }
+
+namespace jubjub::group {
+
+/// Returns `sum(scalars[i] * points[i])` for spans of equal size. Runs in variable time: for public scalars only.
+///
+/// Small inputs use Straus' method, sharing one doubling chain between the width-5 NAFs of all scalars. Larger
+/// ones use Pippenger's bucket method with signed digits in radix `2^c`, where `c` minimises the estimated
+/// number of additions for the input size. The threaded overloads spread Pippenger's windows over up to
+/// `threads` workers, each with its own buckets.
+Extended msm(std::span<const Extended> points, std::span<const field::Fr> scalars);
+Extended msm(std::span<const Extended> points, std::span<const field::Fr> scalars, uint32_t threads);
+
+Extended msm(std::span<const Affine> points, std::span<const field::Fr> scalars);
+Extended msm(std::span<const Affine> points, std::span<const field::Fr> scalars, uint32_t threads);
+
+} // namespace jubjub::group
+
+#endif //JUBJUB_MSM_H
\ No newline at end of file
@@ -0,0 +1,26 @@
+#ifndef JUBJUB_MULTIPLY_MANY_H
+#define JUBJUB_MULTIPLY_MANY_H
+
+#include <cstddef>
+#include <span>
+
+#include "group/extended.h"
+
+namespace jubjub::field { class Fr; }
+
+namespace jubjub::group {
+
+inline constexpr size_t MULTIPLY_MANY_LANES = 2;
+inline constexpr size_t MULTIPLY_MANY_MIN_NORMALIZE = 8;
+
+/// Replaces every point with `by * point`, in constant time.
+///
+/// The scalar is recoded once into the signed radix-16 digits of `Extended::multiply`, and the points are
+/// processed `MULTIPLY_MANY_LANES` at a time with their independent doubling chains interleaved. From
+/// `MULTIPLY_MANY_MIN_NORMALIZE` points on, the window tables of all points are normalized with a single
+/// inversion so that every addition is a mixed one.
+void multiply_many(const field::Fr &by, std::span<Extended> points);
+
+} // namespace jubjub::group
+
+#endif //JUBJUB_MULTIPLY_MANY_H
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef JUBJUB_PROJECTIVE_H
+#define JUBJUB_PROJECTIVE_H
+
+#include "field/fq.h"
+
+namespace jubjub::group {
+
+class Completed;
+class Extended;
+
+/// A point in projective coordinates `(X : Y : Z)`, standing for `(X / Z, Y / Z)`.
+///
+/// Doubling does not read the extended coordinate `T`, so runs of doublings stay in this form and only the last
+/// one is completed into an `Extended`, see `Extended::double_n`.
+class Projective {
+private:
+    field::Fq x;
+    field::Fq y;
+    field::Fq z;
+
+    friend class Extended;
+
+public:
+    Projective();
+    Projective(const Projective &projective);
+    Projective(Projective &&projective) noexcept;
+
+    explicit Projective(const Extended &extended);
+    explicit Projective(const Completed &completed);
+
+    static Projective identity() noexcept;
+
+    [[nodiscard]] bool is_identity() const;
+
+    [[nodiscard]] Projective doubles() const;
+
+    /// Returns the doubling of this point in completed form, from which either coordinate system is 3M away.
+    [[nodiscard]] Completed double_completed() const;
+
+public:
+    Projective &operator=(const Projective &rhs);
+    Projective &operator=(Projective &&rhs) noexcept;
+
+    friend inline bool operator==(const Projective &lhs, const Projective &rhs) {
+        return (lhs.x * rhs.z == rhs.x * lhs.z) && (lhs.y * rhs.z == rhs.y * lhs.z);
+    }
+    friend inline bool operator!=(const Projective &lhs, const Projective &rhs) {
+        return !(lhs == rhs);
+    }
+};
+
+} // namespace jubjub::group
+
+#endif //JUBJUB_PROJECTIVE_H
\ No newline at end of file
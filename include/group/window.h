@@ -0,0 +1,65 @@
+#ifndef JUBJUB_WINDOW_H
+#define JUBJUB_WINDOW_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "group/extended.h"
+#include "group/extended_niels.h"
+
+/// Constant-time variable-base scalar multiplication with signed fixed windows.
+///
+/// The scalar is recoded into `WIDTH`-bit digits in `[-2^(WIDTH-1), 2^(WIDTH-1)]`, so the table only holds the
+/// positive multiples and a digit's sign is applied by negating the selected entry. Every digit costs `WIDTH`
+/// doublings and one addition, and the table is read with masks over all of its entries.
+namespace jubjub::group::window {
+
+constexpr uint8_t WIDTH = 4;
+constexpr size_t TABLE_SIZE = size_t{1} << (WIDTH - 1);
+
+/// Returns `digit * P` from the multiples `entries = [P, 2P, ..., N * P]`, for `digit` in `[-N, N]`.
+///
+/// Every entry is read, and the sign is applied by negating the selected one, so this runs in constant time for
+/// any niels type providing `identity()`, `conditional_select` and unary minus.
+template<typename Niels, size_t N>
+Niels select(const std::array<Niels, N> &entries, int8_t digit) {
+    // the sign is a mask, and the magnitude is compared against every index without branching
+    const auto sign = static_cast<uint8_t>(static_cast<uint8_t>(digit) >> 7);
+    const auto magnitude = static_cast<uint8_t>((digit ^ -sign) + sign);
+
+    Niels res = Niels::identity();
+    for (size_t i = 0; i < N; ++i) {
+        const auto difference = static_cast<uint32_t>(magnitude ^ static_cast<uint8_t>(i + 1));
+        res = Niels::conditional_select(res, entries[i], ((difference - 1) >> 31) & 1);
+    }
+    return Niels::conditional_select(res, -res, sign);
+}
+
+/// The multiples `[P, 2P, ..., TABLE_SIZE * P]` of a point in niels form.
+class LookupTable {
+private:
+    std::array<ExtendedNiels, TABLE_SIZE> entries;
+
+public:
+    explicit LookupTable(const Extended &point);
+
+    /// Returns `digit * P` for `digit` in `[-TABLE_SIZE, TABLE_SIZE]`, touching every entry. Runs in constant time.
+    [[nodiscard]] ExtendedNiels select(int8_t digit) const;
+};
+
+/// Loads the low 252 bits of the little-endian `by`, the part of a scalar that `multiply` and its variable-time
+/// counterparts read; the result stays below 2^253 as the recodings require.
+std::array<uint64_t, 4> load_scalar(const std::array<uint8_t, 32> &by);
+
+/// Returns `by * point` for the little-endian `by`, whose top four bits are ignored like in every `multiply`.
+/// Runs in constant time.
+Extended multiply(const Extended &point, const std::array<uint8_t, 32> &by);
+
+/// Returns `a * p + b * q` with a single doubling chain, reading the scalars like `multiply`. Runs in constant time.
+Extended double_multiply(const std::array<uint8_t, 32> &a, const Extended &p, const std::array<uint8_t, 32> &b,
+                         const Extended &q);
+
+} // namespace jubjub::group::window
+
+#endif //JUBJUB_WINDOW_H
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef JUBJUB_WNAF_H
+#define JUBJUB_WNAF_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "group/extended.h"
+#include "group/extended_niels.h"
+
+/// Variable-time scalar multiplication with width-`WIDTH` non-adjacent forms, for public scalars only.
+///
+/// Every non-zero digit is odd and followed by at least `WIDTH - 1` zeros, so about one position in `WIDTH + 1`
+/// costs an addition from the odd-multiples table. Zero digits cost a doubling and leading zeros nothing.
+namespace jubjub::group::wnaf {
+
+constexpr uint8_t WIDTH = 5;
+constexpr size_t TABLE_SIZE = size_t{1} << (WIDTH - 2);
+
+/// The odd multiples `[P, 3P, ..., (2 * TABLE_SIZE - 1) P]` of a point in niels form.
+class OddMultiples {
+private:
+    std::array<ExtendedNiels, TABLE_SIZE> entries;
+
+public:
+    explicit OddMultiples(const Extended &point);
+
+    /// Returns the entry for the odd `digit` in `(0, 2 * TABLE_SIZE)`.
+    [[nodiscard]] const ExtendedNiels &get(int8_t digit) const { return this->entries[digit / 2]; }
+
+    /// Adds `digit * P` to `acc` for a digit of the width-`WIDTH` NAF, doing nothing when it is zero.
+    void accumulate(Extended &acc, int8_t digit) const;
+};
+
+/// Returns `limbs * point` for `limbs` below 2^255.
+Extended multiply(const Extended &point, const std::array<uint64_t, 4> &limbs);
+
+/// Returns `a * p + b * q` for `a` and `b` below 2^255, interleaving both NAFs over one doubling chain.
+Extended double_multiply(const std::array<uint64_t, 4> &a, const Extended &p, const std::array<uint64_t, 4> &b,
+                         const Extended &q);
+
+} // namespace jubjub::group::wnaf
+
+#endif //JUBJUB_WNAF_H
\ No newline at end of file
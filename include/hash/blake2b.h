@@ -0,0 +1,66 @@
+#ifndef JUBJUB_HASH_BLAKE2B_H
+#define JUBJUB_HASH_BLAKE2B_H
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(JUBJUB_NO_SIMD)
+#define JUBJUB_BLAKE2B_X86 1
+#endif
+
+namespace jubjub::hash {
+
+/// BLAKE2b-512 (RFC 7693) with an optional 16-byte personalization, the form used for domain separation.
+class Blake2b {
+public:
+    static constexpr size_t BLOCK_SIZE = 128;
+    static constexpr size_t OUTPUT_SIZE = 64;
+    static constexpr size_t PERSONAL_SIZE = 16;
+
+    /// Number of messages `hash_many` compresses side by side.
+    static constexpr size_t LANES = 4;
+
+    using Digest = std::array<uint8_t, Blake2b::OUTPUT_SIZE>;
+
+    enum class Backend : uint8_t {
+        PORTABLE,
+        AVX2,
+    };
+
+private:
+    std::array<uint64_t, 8> h;
+    std::array<uint8_t, Blake2b::BLOCK_SIZE> buffer;
+    size_t buffered;
+    uint64_t length;
+
+public:
+    /// `personal` is zero-padded and may not be longer than `PERSONAL_SIZE` bytes, longer ones throw
+    /// `std::invalid_argument`, as do the static functions below.
+    explicit Blake2b(std::string_view personal = {});
+
+    void update(std::span<const uint8_t> data);
+    [[nodiscard]] Digest finalize();
+
+    static Digest hash(std::string_view personal, std::span<const uint8_t> message);
+
+    /// Hashes every message with the same personalization, `LANES` messages at a time when the CPU allows it.
+    static void hash_many(std::string_view personal, std::span<const std::span<const uint8_t>> messages,
+                          std::span<Digest> out, Backend backend = Blake2b::active());
+
+    static Backend detect() noexcept;
+    static bool is_supported(Backend backend) noexcept;
+
+    static Backend active() noexcept {
+        static const Backend backend = Blake2b::detect();
+        return backend;
+    }
+
+private:
+    static std::array<uint64_t, 8> initial_state(std::string_view personal);
+};
+
+} // namespace jubjub::hash
+
+#endif //JUBJUB_HASH_BLAKE2B_H
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef JUBJUB_RANDOM_CHACHA20_RNG_H
+#define JUBJUB_RANDOM_CHACHA20_RNG_H
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "core/rng.h"
+
+namespace jubjub::random {
+
+/// A buffered ChaCha20 keystream generator.
+///
+/// The default constructor draws a 256-bit key from the OS RNG and draws a fresh one after every
+/// `RESEED_INTERVAL` bytes of output, so a single kernel read serves many scalars. A generator built from an
+/// explicit seed is deterministic and never reseeds. Instances are not thread-safe.
+class ChaCha20Rng : public rng::core::RngCore {
+public:
+    static constexpr size_t SEED_SIZE = 32;
+    static constexpr size_t BLOCK_SIZE = 64;
+    static constexpr size_t BUFFER_BLOCKS = 4;
+    static constexpr uint64_t RESEED_INTERVAL = uint64_t{1} << 20;
+
+private:
+    std::array<uint32_t, 8> key;
+    uint64_t counter;
+    uint64_t until_reseed;
+    bool reseeding;
+
+    std::array<uint8_t, BLOCK_SIZE * BUFFER_BLOCKS> buffer;
+    size_t position;
+
+public:
+    ChaCha20Rng();
+    explicit ChaCha20Rng(const std::array<uint8_t, SEED_SIZE> &seed);
+
+    ~ChaCha20Rng() override;
+
+    ChaCha20Rng(const ChaCha20Rng &) = delete;
+    ChaCha20Rng &operator=(const ChaCha20Rng &) = delete;
+
+    uint32_t next_u32() override;
+    uint64_t next_u64() override;
+    void fill_bytes(std::span<uint8_t> dest) override;
+
+    void reseed();
+
+private:
+    void set_key(const std::array<uint8_t, SEED_SIZE> &seed);
+    void generate(std::span<uint8_t> dest);
+    void refill();
+};
+
+} // namespace jubjub::random
+
+#endif //JUBJUB_RANDOM_CHACHA20_RNG_H
\ No newline at end of file
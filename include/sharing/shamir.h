@@ -0,0 +1,74 @@
+#ifndef JUBJUB_SHAMIR_H
+#define JUBJUB_SHAMIR_H
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "core/rng.h"
+
+#include "field/fr.h"
+
+namespace jubjub::sharing {
+
+struct Share {
+    field::Fr index;
+    field::Fr value;
+};
+
+/// A sharing polynomial whose constant term is the secret; any `threshold()` shares recover it.
+class Polynomial {
+private:
+    std::vector<field::Fr> coefficients;
+
+public:
+    explicit Polynomial(std::vector<field::Fr> coefficients);
+    ~Polynomial();
+
+    Polynomial(const Polynomial &polynomial) = default;
+    Polynomial(Polynomial &&polynomial) noexcept = default;
+
+    Polynomial &operator=(const Polynomial &rhs) = default;
+    Polynomial &operator=(Polynomial &&rhs) noexcept = default;
+
+    static Polynomial random(const field::Fr &secret, uint32_t threshold, rng::core::RngCore &rng);
+
+    [[nodiscard]] field::Fr evaluate(const field::Fr &x) const;
+    void evaluate(std::span<const field::Fr> xs, std::span<field::Fr> out) const;
+
+    /// Shares at the indices `1, ..., count`.
+    [[nodiscard]] std::vector<Share> split(uint32_t count) const;
+
+    [[nodiscard]] size_t threshold() const;
+    [[nodiscard]] const std::vector<field::Fr> &get_coefficients() const;
+};
+
+/// The Lagrange coefficients at zero of a fixed set of share indices, reusable across reconstructions.
+class SignerSet {
+private:
+    std::vector<field::Fr> indices;
+    std::vector<field::Fr> coefficients;
+
+    SignerSet(std::vector<field::Fr> indices, std::vector<field::Fr> coefficients);
+
+public:
+    /// Returns nothing when an index is zero or repeated.
+    static std::optional<SignerSet> from_indices(std::span<const field::Fr> indices);
+
+    /// Recovers the secret from share values listed in the order of the indices.
+    [[nodiscard]] field::Fr interpolate(std::span<const field::Fr> values) const;
+
+    /// Recovers the secret, or returns nothing when the shares do not belong to this set, in order.
+    [[nodiscard]] std::optional<field::Fr> reconstruct(std::span<const Share> shares) const;
+
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] const std::vector<field::Fr> &get_indices() const;
+    [[nodiscard]] const std::vector<field::Fr> &get_coefficients() const;
+};
+
+std::optional<field::Fr> reconstruct(std::span<const Share> shares);
+
+} // namespace jubjub::sharing
+
+#endif //JUBJUB_SHAMIR_H
\ No newline at end of file
@@ -1,12 +1,16 @@
 #include "elgamal/cipher.h"
 
 #include "group/affine.h"
+#include "group/fixed_base.h"
+#include "group/fixed_base_cache.h"
 
 namespace jubjub::elgamal {
 
 using field::Fr;
 using group::Affine;
 using group::Extended;
+using group::FixedBaseCache;
+using group::FixedBaseTable;
 
 Cipher::Cipher() = default;
 
@@ -29,10 +33,23 @@ std::optional<Cipher> Cipher::from_bytes(const std::array<uint8_t, Cipher::BYTE_
     return Cipher{Extended{gamma_opt.value()}, Extended{delta_opt.value()}};
 }
 
+namespace {
+
+Extended multiply_generator(const Extended &gen, const Fr &sec) {
+    // the generators come with precomputed tables, which spare every doubling
+    const FixedBaseTable *table = FixedBaseTable::find(gen);
+    return table != nullptr ? table->multiply(sec) : gen * sec;
+}
+
+} // namespace
+
 Cipher Cipher::encrypt(const Fr &sec, const Extended &pub, const Extended &gen, const Extended &msg) {
-    const Extended gamma_extended = gen * sec;
-    const Extended delta_extended = msg + pub * sec;
-    return Cipher{gamma_extended, delta_extended};
+    return Cipher{multiply_generator(gen, sec), msg + pub * sec};
+}
+
+Cipher Cipher::encrypt(const Fr &sec, const Extended &pub, const Extended &gen, const Extended &msg,
+                       FixedBaseCache &cache) {
+    return Cipher{multiply_generator(gen, sec), msg + cache.multiply(pub, sec)};
 }
 
 std::array<uint8_t, Cipher::BYTE_SIZE> Cipher::to_bytes() const {
@@ -0,0 +1,15 @@
+#include "field/fq.h"
+
+#include "field/safegcd.h"
+
+namespace jubjub::field {
+
+std::optional<Fq> Fq::invert() const {
+    if (this->is_zero()) return std::nullopt;
+
+    // safegcd inverts the Montgomery form a * R into a^-1 * R^-1, and R3 brings that back to a^-1 * R
+    static constexpr safegcd::Modulus modulus = safegcd::Modulus::from_limbs(Fq::MODULUS_LIMBS);
+    return Fq{safegcd::invert(this->data, modulus)} * Fq{Fq::R3};
+}
+
+} // namespace jubjub::field
\ No newline at end of file
@@ -1,13 +1,23 @@
 #include "field/fr.h"
 
+#include <algorithm>
+#include <bit>
 #include <cassert>
 #include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 #include "field/constant.h"
+#include "field/exponent.h"
+#include "field/fq.h"
+#include "field/fr_vec.h"
+#include "field/recode.h"
+#include "field/safegcd.h"
 #include "group/extended.h"
+#include "hash/blake2b.h"
 
 #include "utils/bit.h"
-#include "utils/arith.h"
 
 namespace jubjub::field {
 
@@ -17,30 +27,72 @@ using rng::util::bit::from_le_bytes;
 using rng::util::bit::to_le_bytes;
 
 using bls12_381::scalar::Scalar;
-using bls12_381::util::arithmetic::adc;
-using bls12_381::util::arithmetic::sbb;
-using bls12_381::util::arithmetic::mac;
 
-Fr::Fr() : data{0} {}
+using arithmetic::adc;
+using arithmetic::sbb;
 
-Fr::Fr(const Fr &fr) = default;
+namespace {
 
-Fr::Fr(int8_t value) : data{{static_cast<uint64_t>(std::abs(value)), 0, 0, 0}} {
-    if (value < 0) *this = -(*this);
+uint64_t load_le(const uint8_t *bytes) {
+    uint64_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    if constexpr (std::endian::native == std::endian::big) value = __builtin_bswap64(value);
+    return value;
 }
 
-Fr::Fr(uint64_t value) : data{{value, 0, 0, 0}} {
-    *this *= constant::R2;
+void store_le(uint8_t *bytes, uint64_t value) {
+    if constexpr (std::endian::native == std::endian::big) value = __builtin_bswap64(value);
+    std::memcpy(bytes, &value, sizeof(value));
 }
 
-Fr::Fr(const std::array<uint64_t, Fr::WIDTH> &data) : data{data} {}
+using Digits = std::array<uint8_t, Fr::WIDTH * 64>;
 
-Fr::Fr(Fr &&fr) noexcept = default;
+int32_t bit_length(const std::array<uint64_t, Fr::WIDTH> &exp) {
+    for (int32_t i = Fr::WIDTH - 1; i >= 0; --i)
+        if (exp[i] != 0) return i * 64 + 64 - std::countl_zero(exp[i]);
+    return 0;
+}
+
+/// Window width minimising `2^(w-1) + bits / (w + 1)` multiplications.
+int32_t window_width(int32_t bits) {
+    if (bits <= 16) return 1;
+    if (bits <= 64) return 3;
+    if (bits <= 192) return 4;
+    return 5;
+}
+
+/// Splits `exp` into odd windows of at most `width` bits, storing each window's value at its lowest bit.
+void sliding_windows(const std::array<uint64_t, Fr::WIDTH> &exp, int32_t bits, int32_t width, Digits &digits) {
+    digits.fill(0);
+    const uint64_t mask = (uint64_t{1} << width) - 1;
+    int32_t i = 0;
+    while (i < bits) {
+        const int32_t limb = i / 64, shift = i % 64;
+        if (((exp[limb] >> shift) & 1) == 0) {
+            i += 1;
+            continue;
+        }
+
+        uint64_t window = exp[limb] >> shift;
+        if (shift + width > 64 && limb + 1 < Fr::WIDTH)
+            window |= exp[limb + 1] << (64 - shift);
+        digits[i] = static_cast<uint8_t>(window & mask);
+        i += width;
+    }
+}
 
-Fr::Fr(std::array<uint64_t, Fr::WIDTH> &&data) noexcept: data{data} {}
+/// Fills `table` with the odd powers `base, base^3, ..., base^(2^width - 1)`.
+void odd_powers(const Fr &base, int32_t width, std::span<Fr> table) {
+    table[0] = base;
+    if (width == 1) return;
+    const Fr base2 = base.square();
+    for (size_t i = 1; i < (size_t{1} << (width - 1)); ++i)
+        table[i] = table[i - 1] * base2;
+}
+} // namespace
 
-Fr Fr::zero() noexcept {
-    return Fr{};
+Fr::Fr(int8_t value) : data{{static_cast<uint64_t>(std::abs(value)), 0, 0, 0}} {
+    if (value < 0) *this = -(*this);
 }
 
 Fr Fr::one() noexcept {
@@ -53,26 +105,32 @@ Fr Fr::random(rng::core::RngCore &rng) {
     return Fr::from_bytes_wide(bytes);
 }
 
-Fr Fr::montgomery_reduce(const std::array<uint64_t, Fr::WIDTH * 2> &ts) {
-    uint64_t k;
-    uint64_t carry = 0;
-    uint64_t carry2 = 0;
-
-    std::array<uint64_t, Fr::WIDTH * 2> r{};
-    for (int i = 0; i < Fr::WIDTH * 2; ++i)
-        r[i] = i < Fr::WIDTH ? ts[i] : 0;
+void Fr::random_batch(rng::core::RngCore &rng, std::span<Fr> out) {
+    // one read per chunk, then the halves of every wide value are scaled by R2 and R3 as in `from_bytes_wide`
+    constexpr size_t CHUNK_SIZE = 256;
+    std::vector<uint8_t> bytes(CHUNK_SIZE * Fr::BYTE_SIZE * 2);
+    std::array<Fr, CHUNK_SIZE> high;
+
+    for (size_t i = 0; i < out.size(); i += CHUNK_SIZE) {
+        const size_t n = std::min(CHUNK_SIZE, out.size() - i);
+        const std::span<Fr> low = out.subspan(i, n);
+        rng.fill_bytes(std::span(bytes).first(n * Fr::BYTE_SIZE * 2));
+
+        for (size_t j = 0; j < n; ++j) {
+            const uint8_t *wide = bytes.data() + j * Fr::BYTE_SIZE * 2;
+            for (int k = 0; k < Fr::WIDTH; ++k) {
+                low[j].data[k] = load_le(wide + k * sizeof(uint64_t));
+                high[j].data[k] = load_le(wide + Fr::BYTE_SIZE + k * sizeof(uint64_t));
+            }
+        }
 
-    for (int i = 0; i < Fr::WIDTH; ++i) {
-        k = r[i] * constant::INV;
-        carry = 0;
-        r[0] = mac(r[i], k, constant::MODULUS.data[0], carry);
-        for (int j = 1; j < Fr::WIDTH; ++j)
-            r[i + j] = mac(r[i + j], k, constant::MODULUS.data[j], carry);
-        r[i + Fr::WIDTH] = adc(ts[i + Fr::WIDTH], carry2, carry);
-        carry2 = carry;
+        Fr::mul_batch(low, constant::R2);
+        Fr::mul_batch(std::span(high).first(n), constant::R3);
+        for (size_t j = 0; j < n; ++j)
+            low[j] += high[j];
     }
 
-    return Fr({r[4], r[5], r[6], r[7]}) - constant::MODULUS;
+    std::fill(bytes.begin(), bytes.end(), 0);
 }
 
 Fr Fr::from_raw(const std::array<uint64_t, Fr::WIDTH> &values) {
@@ -80,13 +138,9 @@ Fr Fr::from_raw(const std::array<uint64_t, Fr::WIDTH> &values) {
 }
 
 Fr Fr::from_bytes_wide(const std::array<uint8_t, Fr::BYTE_SIZE * 2> &bytes) {
-    std::array<std::array<uint8_t, sizeof(uint64_t)>, Fr::WIDTH * 2> array{};
     std::array<uint64_t, Fr::WIDTH * 2> data{};
-
-    for (int i = 0; i < bytes.size(); ++i)
-        array[i / sizeof(uint64_t)][i % sizeof(uint64_t)] = bytes[i];
     for (int i = 0; i < data.size(); ++i)
-        data[i] = from_le_bytes<uint64_t>(array[i]);
+        data[i] = load_le(bytes.data() + i * sizeof(uint64_t));
 
     return Fr::reduce(data);
 }
@@ -116,6 +170,137 @@ std::optional<Fr> Fr::from_bytes(const std::array<uint8_t, Fr::BYTE_SIZE> &bytes
     }
 }
 
+Fr Fr::hash_to_scalar(std::string_view domain, std::span<const uint8_t> message) {
+    return Fr::from_bytes_wide(hash::Blake2b::hash(domain, message));
+}
+
+void Fr::hash_to_scalar_batch(std::string_view domain, std::span<const std::span<const uint8_t>> messages,
+                              std::span<Fr> out) {
+    assert(messages.size() == out.size());
+
+    std::vector<hash::Blake2b::Digest> digests(messages.size());
+    hash::Blake2b::hash_many(domain, messages, digests);
+    for (size_t i = 0; i < digests.size(); ++i)
+        out[i] = Fr::from_bytes_wide(digests[i]);
+}
+
+size_t Fr::decode_batch(std::span<const uint8_t> bytes, std::span<Fr> out) {
+    assert(bytes.size() == out.size() * Fr::BYTE_SIZE);
+
+    size_t first_invalid = out.size();
+    for (size_t i = 0; i < out.size(); ++i) {
+        std::array<uint64_t, Fr::WIDTH> limbs{};
+        for (int j = 0; j < Fr::WIDTH; ++j)
+            limbs[j] = load_le(bytes.data() + i * Fr::BYTE_SIZE + j * sizeof(uint64_t));
+
+        // all ones when the encoding is below the modulus
+        uint64_t borrow = 0;
+        for (int j = 0; j < Fr::WIDTH; ++j)
+            sbb(limbs[j], Fr::MODULUS_LIMBS[j], borrow);
+        for (int j = 0; j < Fr::WIDTH; ++j)
+            out[i].data[j] = limbs[j] & borrow;
+
+        first_invalid = std::min(first_invalid, (i & ~borrow) | (out.size() & borrow));
+    }
+
+    Fr::mul_batch(out, constant::R2);
+    return first_invalid;
+}
+
+void Fr::encode_batch(std::span<const Fr> values, std::span<uint8_t> out) {
+    assert(out.size() == values.size() * Fr::BYTE_SIZE);
+
+    // multiplying by the raw integer one is a Montgomery reduction
+    constexpr size_t CHUNK_SIZE = 1024;
+    std::array<Fr, CHUNK_SIZE> reduced;
+    for (size_t i = 0; i < values.size(); i += CHUNK_SIZE) {
+        const size_t n = std::min(CHUNK_SIZE, values.size() - i);
+        std::copy(values.begin() + i, values.begin() + i + n, reduced.begin());
+        Fr::mul_batch(std::span(reduced).first(n), Fr{{1, 0, 0, 0}});
+
+        for (size_t j = 0; j < n; ++j)
+            for (int k = 0; k < Fr::WIDTH; ++k)
+                store_le(out.data() + (i + j) * Fr::BYTE_SIZE + k * sizeof(uint64_t), reduced[j].data[k]);
+    }
+}
+
+void Fr::from_u64_batch(std::span<const uint64_t> values, std::span<Fr> out) {
+    assert(values.size() == out.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+        out[i] = Fr{{values[i], 0, 0, 0}};
+    Fr::mul_batch(out, constant::R2);
+}
+
+void Fr::mul_batch(std::span<Fr> values, const Fr &factor) {
+    if (!FrVec::pays_off(values.size())) {
+        for (Fr &value: values)
+            value *= factor;
+        return;
+    }
+
+    for (size_t i = 0; i < values.size(); i += FrVec::CHUNK_SIZE) {
+        const std::span<Fr> chunk = values.subspan(i, std::min(FrVec::CHUNK_SIZE, values.size() - i));
+        FrVec vec{chunk};
+        FrVec::mul(vec, vec, FrVec(chunk.size(), factor));
+        for (size_t j = 0; j < chunk.size(); ++j)
+            chunk[j] = vec.get(j);
+    }
+}
+
+Fr Fr::conditional_select(const Fr &a, const Fr &b, bool choice) {
+    const uint64_t mask = -static_cast<uint64_t>(choice);
+    std::array<uint64_t, Fr::WIDTH> res{};
+    for (int i = 0; i < Fr::WIDTH; ++i)
+        res[i] = (a.data[i] & ~mask) | (b.data[i] & mask);
+    return Fr{res};
+}
+
+void Fr::batch_invert(std::span<Fr> values) {
+    if (values.empty()) return;
+
+    // zeros are swapped for one on the way in and left untouched on the way out, so they cannot poison the batch
+    std::vector<Fr> prefix;
+    prefix.reserve(values.size());
+
+    Fr acc = Fr::one();
+    for (const Fr &value: values) {
+        prefix.push_back(acc);
+        acc *= Fr::conditional_select(value, Fr::one(), value.is_zero());
+    }
+
+    acc = acc.invert().value();
+
+    for (size_t i = values.size(); i-- > 0;) {
+        const bool skip = values[i].is_zero();
+        const Fr inverse = acc * prefix[i];
+        acc *= Fr::conditional_select(values[i], Fr::one(), skip);
+        values[i] = Fr::conditional_select(inverse, values[i], skip);
+    }
+}
+
+void Fr::batch_invert(std::span<Fr> values, uint32_t threads) {
+    constexpr size_t MIN_CHUNK_SIZE = 1024;
+
+    const size_t max_threads = std::max<size_t>(values.size() / MIN_CHUNK_SIZE, 1);
+    const size_t num_threads = std::clamp<size_t>(threads, 1, max_threads);
+    if (num_threads == 1) {
+        Fr::batch_invert(values);
+        return;
+    }
+
+    const size_t chunk_size = (values.size() + num_threads - 1) / num_threads;
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads - 1);
+    for (size_t start = chunk_size; start < values.size(); start += chunk_size) {
+        const std::span<Fr> chunk = values.subspan(start, std::min(chunk_size, values.size() - start));
+        workers.emplace_back([chunk]() { Fr::batch_invert(chunk); });
+    }
+
+    Fr::batch_invert(values.first(chunk_size));
+    for (std::thread &worker: workers) worker.join();
+}
+
 bool Fr::is_even() const {
     return this->data[0] % 2 == 0;
 }
@@ -126,7 +311,28 @@ bool Fr::is_zero() const {
 }
 
 std::optional<Scalar> Fr::to_bls_scalar() const {
-    return Scalar::from_bytes(this->to_bytes());
+    // MODULUS is below the Fq modulus, so the canonical limbs need no range check and one multiplication by R2
+    // gives the Montgomery form that Scalar shares with Fq
+    const Fr canonical = Fr::montgomery_reduce(
+            {this->data[0], this->data[1], this->data[2], this->data[3], 0, 0, 0, 0}
+    );
+    return (Fq{canonical.data} * Fq{Fq::R2}).to_scalar();
+}
+
+void Fr::to_bls_scalar_batch(std::span<const Fr> values, std::span<Scalar> out) {
+    assert(values.size() == out.size());
+
+    // multiplying by the raw integer one is a Montgomery reduction, vectorized by `mul_batch`
+    constexpr size_t CHUNK_SIZE = 1024;
+    std::array<Fr, CHUNK_SIZE> canonical;
+    for (size_t i = 0; i < values.size(); i += CHUNK_SIZE) {
+        const size_t n = std::min(CHUNK_SIZE, values.size() - i);
+        std::copy(values.begin() + i, values.begin() + i + n, canonical.begin());
+        Fr::mul_batch(std::span(canonical).first(n), Fr{{1, 0, 0, 0}});
+
+        for (size_t j = 0; j < n; ++j)
+            out[i + j] = (Fq{canonical[j].data} * Fq{Fq::R2}).to_scalar();
+    }
 }
 
 std::array<uint8_t, Fr::BYTE_SIZE> Fr::to_bytes() const {
@@ -151,43 +357,99 @@ Fr Fr::doubles() const {
     return *this + *this;
 }
 
-Fr Fr::square() const {
-    uint64_t carry = 0;
-    std::array<uint64_t, Fr::WIDTH * 2> r{0};
-
-    for (int i = 0; i < Fr::WIDTH - 1; ++i) {
-        carry = 0;
-        for (int j = 0; j < Fr::WIDTH - i - 2; ++j) {
-            int32_t anchor = i * 2 + j + 1;
-            r[anchor] = mac(r[anchor], this->data[i], this->data[i + j + 1], carry);
+Fr Fr::pow(const std::array<uint64_t, Fr::WIDTH> &exp) const {
+    Fr res = Fr::one();
+    for (int i = Fr::WIDTH - 1; i >= 0; --i) {
+        for (int j = 63; j >= 0; --j) {
+            res = res.square();
+            if (((exp[i] >> j) & 0x01) == 0x01) res *= *this;
         }
-        r[i + Fr::WIDTH - 1] = mac(r[i + Fr::WIDTH - 1], this->data[i], this->data[Fr::WIDTH - 1], carry);
-        r[i + Fr::WIDTH] = carry;
     }
+    return res;
+}
 
-    r[7] = r[6] >> 63;
-    for (int i = 6; i >= 2; --i) r[i] = (r[i] << 1) | (r[i - 1] >> 63);
-    r[1] = r[1] << 1;
-
-    carry = 0;
-    r[0] = 0;
-    for (int i = 0; i < Fr::WIDTH * 2; ++i) {
-        if (i % 2 == 0) {
-            r[i] = mac(r[i], this->data[i / 2], this->data[i / 2], carry);
-        } else {
-            r[i] = adc(r[i], 0, carry);
-        }
+Fr Fr::sum(std::span<const Fr> values) {
+    // every value is below 2^252, so a fifth limb holds the carries of 2^64 of them
+    std::array<uint64_t, Fr::WIDTH * 2> acc{};
+    for (const Fr &value: values) {
+        uint64_t carry = 0;
+        for (int i = 0; i < Fr::WIDTH; ++i)
+            acc[i] = adc(acc[i], value.data[i], carry);
+        acc[Fr::WIDTH] += carry;
     }
 
-    return Fr::montgomery_reduce(r);
+    // REDC takes the wide sum to `sum / R`, and the multiplication by R2 brings it back to `sum`
+    return Fr::montgomery_reduce(acc) * constant::R2;
 }
 
-Fr Fr::pow(const std::array<uint64_t, Fr::WIDTH> &exp) const {
+Fr Fr::sum_of_products(std::span<const Fr> a, std::span<const Fr> b) {
+    // REDC needs its input below MODULUS * 2^256, and every product is below MODULUS^2
+    constexpr size_t CHUNK_SIZE = 16;
+    static_assert(Fr::MODULUS_LIMBS[3] < UINT64_MAX / CHUNK_SIZE, "CHUNK_SIZE * MODULUS must stay below 2^256");
+
+    assert(a.size() == b.size());
+
+    Fr res = Fr::zero();
+    for (size_t i = 0; i < a.size(); i += CHUNK_SIZE) {
+        montgomery::WideLimbs acc{};
+        const size_t end = std::min(a.size(), i + CHUNK_SIZE);
+        for (size_t j = i; j < end; ++j)
+            montgomery::portable::mul_add_wide(acc, a[j].data, b[j].data);
+        res += Fr::montgomery_reduce(acc);
+    }
+    return res;
+}
+
+Fr Fr::pow_vartime(const std::array<uint64_t, Fr::WIDTH> &exp) const {
+    const int32_t bits = bit_length(exp);
+    if (bits == 0) return Fr::one();
+
+    const int32_t width = window_width(bits);
+    Digits digits;
+    sliding_windows(exp, bits, width, digits);
+
+    std::array<Fr, 16> table;
+    odd_powers(*this, width, table);
+
+    // the topmost window seeds the accumulator, which skips the squarings of one
+    int32_t i = bits - 1;
+    while (digits[i] == 0) --i;
+    Fr res = table[digits[i] >> 1];
+    for (--i; i >= 0; --i) {
+        res = res.square();
+        if (digits[i] != 0) res *= table[digits[i] >> 1];
+    }
+    return res;
+}
+
+Fr Fr::multi_pow_vartime(std::span<const Fr> bases, std::span<const std::array<uint64_t, Fr::WIDTH>> exps) {
+    assert(bases.size() == exps.size());
+
+    int32_t bits = 0;
+    for (const auto &exp: exps)
+        bits = std::max(bits, bit_length(exp));
+    if (bits == 0) return Fr::one();
+
+    const int32_t width = window_width(bits);
+    const size_t table_size = size_t{1} << (width - 1);
+
+    std::vector<Digits> digits(bases.size());
+    std::vector<Fr> tables(bases.size() * table_size);
+    for (size_t j = 0; j < bases.size(); ++j) {
+        sliding_windows(exps[j], bits, width, digits[j]);
+        odd_powers(bases[j], width, std::span(tables).subspan(j * table_size, table_size));
+    }
+
+    // a single chain of squarings is shared by every base
     Fr res = Fr::one();
-    for (int i = Fr::WIDTH - 1; i >= 0; --i) {
-        for (int j = 63; j >= 0; --j) {
-            res = res.square();
-            if (((exp[i] >> j) & 0x01) == 0x01) res *= *this;
+    bool started = false;
+    for (int32_t i = bits - 1; i >= 0; --i) {
+        if (started) res = res.square();
+        for (size_t j = 0; j < bases.size(); ++j) {
+            if (digits[j][i] == 0) continue;
+            const Fr &power = tables[j * table_size + (digits[j][i] >> 1)];
+            res = started ? res * power : power;
+            started = true;
         }
     }
     return res;
@@ -222,19 +484,51 @@ void Fr::div_n(uint32_t n) {
 }
 
 std::optional<Fr> Fr::sqrt() const {
-    const Fr sqrt = this->pow(
-            {
-                    0xb425c397b5bdcb2e, 0x299a0824f3320420,
-                    0x4199cec0404d0ec0, 0x039f6d3a994cebea,
-            }
-    );
+    // (MODULUS + 1) / 4, as MODULUS = 3 mod 4
+    constexpr exponent::Exponent SQRT_EXP = {
+            0xb425c397b5bdcb2e, 0x299a0824f3320420,
+            0x4199cec0404d0ec0, 0x039f6d3a994cebea,
+    };
+
+    const Fr sqrt = exponent::pow<SQRT_EXP>(*this);
     if (sqrt.square() == *this)
         return sqrt;
     else
         return std::nullopt;
 }
 
-std::optional<Fr> Fr::invert() const {
+int8_t Fr::legendre() const {
+    // (MODULUS - 1) / 2
+    constexpr exponent::Exponent LEGENDRE_EXP = {
+            0x684b872f6b7b965b, 0x53341049e6640841,
+            0x83339d80809a1d80, 0x073eda753299d7d4,
+    };
+
+    const Fr symbol = exponent::pow<LEGENDRE_EXP>(*this);
+    if (symbol.is_zero())
+        return 0;
+    else if (symbol == Fr::one())
+        return 1;
+    else
+        return -1;
+}
+
+bool Fr::is_square() const {
+    return this->legendre() >= 0;
+}
+
+std::optional<Fr> Fr::invert(Inversion method) const {
+    if (method == Inversion::SAFEGCD) {
+        static constexpr safegcd::Modulus modulus = safegcd::Modulus::from_limbs(Fr::MODULUS_LIMBS);
+
+        // inverting the Montgomery form x * R yields x^-1 * R^-1, which one multiplication by R^3 turns into x^-1 * R
+        const Fr inverse = Fr{safegcd::invert(this->data, modulus)} * constant::R3;
+        if (this->is_zero())
+            return std::nullopt;
+        else
+            return inverse;
+    }
+
     const auto square_assign_multi = [](Fr &n, size_t num_times) {
         for (int i = 0; i < num_times; ++i) n = n.square();
     };
@@ -351,89 +645,38 @@ int8_t Fr::mod_k(uint8_t w) const {
 }
 
 std::array<int8_t, 256> Fr::compute_windowed_non_adjacent(uint8_t width) const {
-    Fr k = this->self_reduce();
-    size_t i = 0;
-    Fr one = Fr::one().self_reduce();
     std::array<int8_t, 256> res{};
-
-    while (k >= one) {
-        if (!k.is_even()) {
-            const int8_t ki = k.mod_k(width);
-            res[i] = ki;
-            k = k - Fr{ki};
-        } else {
-            res[i] = 0;
-        }
-
-        k.div_n(1);
-        i += 1;
-    }
+    this->wnaf(width, res);
     return res;
 }
 
-Fr Fr::reduce(const std::array<uint64_t, Fr::WIDTH * 2> &limbs) {
-    const Fr d0({limbs[0], limbs[1], limbs[2], limbs[3]});
-    const Fr d1({limbs[4], limbs[5], limbs[6], limbs[7]});
-    return d0 * constant::R2 + d1 * constant::R3;
+size_t Fr::wnaf(uint8_t width, std::span<int8_t, 256> digits) const {
+    return recode::wnaf(this->self_reduce().data, width, digits);
 }
 
-Fr Fr::operator-() const {
-    uint64_t borrow = 0;
-    uint64_t d[Fr::WIDTH];
-
-    for (int i = 0; i < Fr::WIDTH; ++i)
-        d[i] = sbb(constant::MODULUS.data[i], this->data[i], borrow);
-
-    bool dec = (this->data[0] | this->data[1] | this->data[2] | this->data[3]) == 0;
-    uint64_t mask = static_cast<uint64_t>(dec) - 1;
-
-    return Fr(
-            {
-                    d[0] & mask, d[1] & mask,
-                    d[2] & mask, d[3] & mask,
-            }
-    );
+size_t Fr::radix_2w(uint8_t width, std::span<int8_t, 256> digits) const {
+    return recode::radix_2w(this->self_reduce().data, width, digits);
 }
 
-Fr &Fr::operator=(const Fr &rhs) = default;
-
-Fr &Fr::operator=(Fr &&rhs) noexcept = default;
-
-Fr &Fr::operator+=(const Fr &rhs) {
-    uint64_t carry = 0;
-    uint64_t d[Fr::WIDTH];
-    for (int i = 0; i < Fr::WIDTH; ++i)
-        d[i] = adc(this->data[i], rhs.data[i], carry);
-    *this = Fr({d[0], d[1], d[2], d[3]}) - constant::MODULUS;
-    return *this;
-}
+Fr Fr::reduce(const std::array<uint64_t, Fr::WIDTH * 2> &limbs) {
+    // REDC of the whole value gives limbs / R, and one multiplication by R3 brings it to limbs * R
+    uint64_t carry;
+    std::array<uint64_t, Fr::WIDTH> x;
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+    if (montgomery::active() == montgomery::Backend::MULX_ADX)
+        x = montgomery::mulx_adx::reduce_wide(limbs, Fr::MODULUS_LIMBS, Fr::INV, carry);
+    else
+#endif
+        x = montgomery::portable::reduce_wide(limbs, Fr::MODULUS_LIMBS, Fr::INV, carry);
 
-Fr &Fr::operator-=(const Fr &rhs) {
-    uint64_t borrow = 0;
-    uint64_t d[Fr::WIDTH];
+    // a set carry leaves x below MODULUS, and the dropped 2^256 comes back as R mod MODULUS
+    const uint64_t mask = -carry;
+    uint64_t c = 0;
     for (int i = 0; i < Fr::WIDTH; ++i)
-        d[i] = sbb(this->data[i], rhs.data[i], borrow);
-    uint64_t carry = 0;
-    for (int i = 0; i < Fr::WIDTH; ++i)
-        d[i] = adc(d[i], constant::MODULUS.data[i] & borrow, carry);
-    *this = Fr({d[0], d[1], d[2], d[3]});
-    return *this;
-}
-
-Fr &Fr::operator*=(const Fr &rhs) {
-    uint64_t carry = 0;
-    std::array<uint64_t, Fr::WIDTH * 2> r{0};
-
-    for (int i = 0; i < Fr::WIDTH; ++i) {
-        carry = 0;
-        for (int j = 0; j < Fr::WIDTH - 1; ++j)
-            r[i + j] = mac(i == 0 ? 0 : r[i + j], this->data[i], rhs.data[j], carry);
-        r[i + Fr::WIDTH - 1] = mac(i == 0 ? 0 : r[i + Fr::WIDTH - 1], this->data[i], rhs.data[Fr::WIDTH - 1], carry);
-        r[i + Fr::WIDTH] = carry;
-    }
+        x[i] = adc(x[i], constant::R1.data[i] & mask, c);
 
-    *this = Fr::montgomery_reduce(r);
-    return *this;
+    // x may exceed MODULUS, so it supplies the multiplier limbs while the reduced R3 is the multiplicand
+    return constant::R3 * Fr{x};
 }
 
 std::strong_ordering operator<=>(const Fr &lhs, const Fr &rhs) {
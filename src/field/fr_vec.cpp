@@ -0,0 +1,489 @@
+#include "field/fr_vec.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+#ifdef JUBJUB_FR_VEC_X86
+#include <immintrin.h>
+#endif
+
+namespace jubjub::field {
+
+namespace {
+
+using Backend = FrVec::Backend;
+using Op = FrVec::Op;
+
+/// Pointers to the four limb columns of a vector.
+using Columns = std::array<uint64_t *, Fr::WIDTH>;
+using ConstColumns = std::array<const uint64_t *, Fr::WIDTH>;
+
+#ifdef JUBJUB_FR_VEC_X86
+
+/// Four elements per `__m256i`, each as eight 32-bit words kept in the low halves of 64-bit lanes.
+namespace avx2 {
+
+#define JUBJUB_TARGET_AVX2 __attribute__((target("avx2")))
+
+constexpr int32_t WORDS = 8;
+
+/// A C array in a struct, as vector types lose their alignment attributes as template arguments of `std::array`.
+struct Words {
+    __m256i w[WORDS];
+
+    __m256i &operator[](int32_t k) { return this->w[k]; }
+    const __m256i &operator[](int32_t k) const { return this->w[k]; }
+};
+
+JUBJUB_TARGET_AVX2 inline Words broadcast(const std::array<uint64_t, Fr::WIDTH> &limbs) {
+    Words w;
+    for (int32_t k = 0; k < Fr::WIDTH; ++k) {
+        w[2 * k] = _mm256_set1_epi64x(static_cast<int64_t>(limbs[k] & 0xffffffff));
+        w[2 * k + 1] = _mm256_set1_epi64x(static_cast<int64_t>(limbs[k] >> 32));
+    }
+    return w;
+}
+
+JUBJUB_TARGET_AVX2 inline Words load(const ConstColumns &a, size_t i) {
+    const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    Words w;
+    for (int32_t k = 0; k < Fr::WIDTH; ++k) {
+        const __m256i limb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a[k] + i));
+        w[2 * k] = _mm256_and_si256(limb, mask);
+        w[2 * k + 1] = _mm256_srli_epi64(limb, 32);
+    }
+    return w;
+}
+
+JUBJUB_TARGET_AVX2 inline void store(const Columns &out, size_t i, const Words &w) {
+    for (int32_t k = 0; k < Fr::WIDTH; ++k) {
+        const __m256i limb = _mm256_or_si256(w[2 * k], _mm256_slli_epi64(w[2 * k + 1], 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out[k] + i), limb);
+    }
+}
+
+/// Subtracts the modulus from `t` unless that borrows, for `t` in `[0, 2 * modulus)`.
+JUBJUB_TARGET_AVX2 inline Words subtract_modulus(const Words &t, const Words &p) {
+    const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    Words d;
+    __m256i borrow = _mm256_setzero_si256();
+    for (int32_t k = 0; k < WORDS; ++k) {
+        const __m256i s = _mm256_sub_epi64(_mm256_sub_epi64(t[k], p[k]), borrow);
+        d[k] = _mm256_and_si256(s, mask);
+        borrow = _mm256_srli_epi64(s, 63);
+    }
+
+    // all ones where the subtraction borrowed and `t` is kept
+    const __m256i keep = _mm256_sub_epi64(_mm256_setzero_si256(), borrow);
+    for (int32_t k = 0; k < WORDS; ++k)
+        d[k] = _mm256_blendv_epi8(d[k], t[k], keep);
+    return d;
+}
+
+JUBJUB_TARGET_AVX2 inline Words add(const Words &a, const Words &b, const Words &p) {
+    const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    Words t;
+    __m256i carry = _mm256_setzero_si256();
+    for (int32_t k = 0; k < WORDS; ++k) {
+        const __m256i s = _mm256_add_epi64(_mm256_add_epi64(a[k], b[k]), carry);
+        t[k] = _mm256_and_si256(s, mask);
+        carry = _mm256_srli_epi64(s, 32);
+    }
+    return subtract_modulus(t, p);
+}
+
+JUBJUB_TARGET_AVX2 inline Words sub(const Words &a, const Words &b, const Words &p) {
+    const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    Words t;
+    __m256i borrow = _mm256_setzero_si256();
+    for (int32_t k = 0; k < WORDS; ++k) {
+        const __m256i s = _mm256_sub_epi64(_mm256_sub_epi64(a[k], b[k]), borrow);
+        t[k] = _mm256_and_si256(s, mask);
+        borrow = _mm256_srli_epi64(s, 63);
+    }
+
+    // add the modulus back where the subtraction borrowed
+    const __m256i add_back = _mm256_sub_epi64(_mm256_setzero_si256(), borrow);
+    __m256i carry = _mm256_setzero_si256();
+    for (int32_t k = 0; k < WORDS; ++k) {
+        const __m256i s = _mm256_add_epi64(_mm256_add_epi64(t[k], _mm256_and_si256(p[k], add_back)), carry);
+        t[k] = _mm256_and_si256(s, mask);
+        carry = _mm256_srli_epi64(s, 32);
+    }
+    return t;
+}
+
+/// CIOS Montgomery multiplication on 32-bit words. Every `word * word + word + word` fits in a 64-bit lane,
+/// and eight rounds of 32 bits divide by the same `R = 2^256` as `Fr`.
+JUBJUB_TARGET_AVX2 inline Words mul(const Words &a, const Words &b, const Words &p, __m256i inv) {
+    const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+
+    __m256i t[WORDS + 1];
+    std::fill(std::begin(t), std::end(t), _mm256_setzero_si256());
+    for (int32_t i = 0; i < WORDS; ++i) {
+        __m256i carry = _mm256_setzero_si256();
+        for (int32_t j = 0; j < WORDS; ++j) {
+            const __m256i s = _mm256_add_epi64(_mm256_add_epi64(t[j], _mm256_mul_epu32(a[j], b[i])), carry);
+            t[j] = _mm256_and_si256(s, mask);
+            carry = _mm256_srli_epi64(s, 32);
+        }
+        t[WORDS] = _mm256_add_epi64(t[WORDS], carry);
+
+        const __m256i m = _mm256_and_si256(_mm256_mul_epu32(t[0], inv), mask);
+        carry = _mm256_srli_epi64(_mm256_add_epi64(t[0], _mm256_mul_epu32(m, p[0])), 32);
+        for (int32_t j = 1; j < WORDS; ++j) {
+            const __m256i s = _mm256_add_epi64(_mm256_add_epi64(t[j], _mm256_mul_epu32(m, p[j])), carry);
+            t[j - 1] = _mm256_and_si256(s, mask);
+            carry = _mm256_srli_epi64(s, 32);
+        }
+        const __m256i s = _mm256_add_epi64(t[WORDS], carry);
+        t[WORDS - 1] = _mm256_and_si256(s, mask);
+        t[WORDS] = _mm256_srli_epi64(s, 32);
+    }
+
+    Words r;
+    std::copy(t, t + WORDS, r.w);
+    return subtract_modulus(r, p);
+}
+
+JUBJUB_TARGET_AVX2 void apply(Op op, const Columns &out, const ConstColumns &a, const ConstColumns &b, size_t n,
+                              const std::array<uint64_t, Fr::WIDTH> &modulus, uint64_t inv) {
+    const Words p = broadcast(modulus);
+    const __m256i inv32 = _mm256_set1_epi64x(static_cast<int64_t>(inv & 0xffffffff));
+    for (size_t i = 0; i < n; i += 4) {
+        const Words x = load(a, i);
+        switch (op) {
+            case Op::ADD:
+                store(out, i, add(x, load(b, i), p));
+                break;
+            case Op::SUB:
+                store(out, i, sub(x, load(b, i), p));
+                break;
+            case Op::MUL:
+                store(out, i, mul(x, load(b, i), p, inv32));
+                break;
+            case Op::SQUARE:
+                store(out, i, mul(x, x, p, inv32));
+                break;
+        }
+    }
+}
+
+} // namespace avx2
+
+/// Eight elements per `__m512i`, each as five 52-bit limbs for the IFMA multiply-accumulate instructions.
+namespace avx512_ifma {
+
+#define JUBJUB_TARGET_AVX512_IFMA __attribute__((target("avx512f,avx512ifma")))
+
+constexpr int32_t LIMBS = 5;
+constexpr uint64_t MASK52 = (uint64_t{1} << 52) - 1;
+constexpr uint64_t MASK48 = (uint64_t{1} << 48) - 1;
+
+/// Wrapped like `avx2::Words`, for the same reason.
+struct Limbs {
+    __m512i l[LIMBS];
+
+    __m512i &operator[](int32_t k) { return this->l[k]; }
+    const __m512i &operator[](int32_t k) const { return this->l[k]; }
+};
+
+constexpr std::array<uint64_t, LIMBS> to_radix52(const std::array<uint64_t, Fr::WIDTH> &a) {
+    return {
+            a[0] & MASK52,
+            ((a[0] >> 52) | (a[1] << 12)) & MASK52,
+            ((a[1] >> 40) | (a[2] << 24)) & MASK52,
+            ((a[2] >> 28) | (a[3] << 36)) & MASK52,
+            a[3] >> 16,
+    };
+}
+
+JUBJUB_TARGET_AVX512_IFMA inline Limbs broadcast(const std::array<uint64_t, Fr::WIDTH> &limbs) {
+    const std::array<uint64_t, LIMBS> radix52 = to_radix52(limbs);
+    Limbs l;
+    for (int32_t k = 0; k < LIMBS; ++k)
+        l[k] = _mm512_set1_epi64(static_cast<int64_t>(radix52[k]));
+    return l;
+}
+
+JUBJUB_TARGET_AVX512_IFMA inline Limbs load(const ConstColumns &a, size_t i) {
+    const __m512i mask = _mm512_set1_epi64(MASK52);
+    const __m512i a0 = _mm512_loadu_si512(a[0] + i);
+    const __m512i a1 = _mm512_loadu_si512(a[1] + i);
+    const __m512i a2 = _mm512_loadu_si512(a[2] + i);
+    const __m512i a3 = _mm512_loadu_si512(a[3] + i);
+    return {
+            _mm512_and_si512(a0, mask),
+            _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(a0, 52), _mm512_slli_epi64(a1, 12)), mask),
+            _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(a1, 40), _mm512_slli_epi64(a2, 24)), mask),
+            _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(a2, 28), _mm512_slli_epi64(a3, 36)), mask),
+            _mm512_srli_epi64(a3, 16),
+    };
+}
+
+JUBJUB_TARGET_AVX512_IFMA inline void store(const Columns &out, size_t i, const Limbs &r) {
+    _mm512_storeu_si512(out[0] + i, _mm512_or_si512(r[0], _mm512_slli_epi64(r[1], 52)));
+    _mm512_storeu_si512(out[1] + i, _mm512_or_si512(_mm512_srli_epi64(r[1], 12), _mm512_slli_epi64(r[2], 40)));
+    _mm512_storeu_si512(out[2] + i, _mm512_or_si512(_mm512_srli_epi64(r[2], 24), _mm512_slli_epi64(r[3], 28)));
+    _mm512_storeu_si512(out[3] + i, _mm512_or_si512(_mm512_srli_epi64(r[3], 36), _mm512_slli_epi64(r[4], 16)));
+}
+
+/// Subtracts the modulus from `t` unless that borrows, for normalised `t` in `[0, 2 * modulus)`.
+JUBJUB_TARGET_AVX512_IFMA inline Limbs subtract_modulus(const Limbs &t, const Limbs &p) {
+    const __m512i mask = _mm512_set1_epi64(MASK52);
+    Limbs d;
+    __m512i borrow = _mm512_setzero_si512();
+    for (int32_t k = 0; k < LIMBS; ++k) {
+        const __m512i s = _mm512_sub_epi64(_mm512_sub_epi64(t[k], p[k]), borrow);
+        d[k] = _mm512_and_si512(s, mask);
+        borrow = _mm512_srli_epi64(s, 63);
+    }
+
+    const __mmask8 keep = _mm512_test_epi64_mask(borrow, borrow);
+    for (int32_t k = 0; k < LIMBS; ++k)
+        d[k] = _mm512_mask_blend_epi64(keep, d[k], t[k]);
+    return d;
+}
+
+JUBJUB_TARGET_AVX512_IFMA inline Limbs add(const Limbs &a, const Limbs &b, const Limbs &p) {
+    const __m512i mask = _mm512_set1_epi64(MASK52);
+    Limbs t;
+    __m512i carry = _mm512_setzero_si512();
+    for (int32_t k = 0; k < LIMBS; ++k) {
+        const __m512i s = _mm512_add_epi64(_mm512_add_epi64(a[k], b[k]), carry);
+        t[k] = _mm512_and_si512(s, mask);
+        carry = _mm512_srli_epi64(s, 52);
+    }
+    return subtract_modulus(t, p);
+}
+
+JUBJUB_TARGET_AVX512_IFMA inline Limbs sub(const Limbs &a, const Limbs &b, const Limbs &p) {
+    const __m512i mask = _mm512_set1_epi64(MASK52);
+    Limbs t;
+    __m512i borrow = _mm512_setzero_si512();
+    for (int32_t k = 0; k < LIMBS; ++k) {
+        const __m512i s = _mm512_sub_epi64(_mm512_sub_epi64(a[k], b[k]), borrow);
+        t[k] = _mm512_and_si512(s, mask);
+        borrow = _mm512_srli_epi64(s, 63);
+    }
+
+    // add the modulus back where the subtraction borrowed
+    const __mmask8 add_back = _mm512_test_epi64_mask(borrow, borrow);
+    __m512i carry = _mm512_setzero_si512();
+    for (int32_t k = 0; k < LIMBS; ++k) {
+        const __m512i s = _mm512_add_epi64(_mm512_mask_add_epi64(t[k], add_back, t[k], p[k]), carry);
+        t[k] = _mm512_and_si512(s, mask);
+        carry = _mm512_srli_epi64(s, 52);
+    }
+    return t;
+}
+
+/// Schoolbook product followed by Montgomery reduction. Four rounds clear 52 bits each and a last round
+/// clears 48, so that the result is divided by the same `R = 2^256` as `Fr`. Carries between the 64-bit
+/// accumulators are only resolved once at the end of the reduction.
+JUBJUB_TARGET_AVX512_IFMA inline Limbs mul(const Limbs &a, const Limbs &b, const Limbs &p, __m512i inv) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i mask52 = _mm512_set1_epi64(MASK52);
+
+    __m512i t[2 * LIMBS];
+    std::fill(std::begin(t), std::end(t), zero);
+    for (int32_t i = 0; i < LIMBS; ++i) {
+        for (int32_t j = 0; j < LIMBS; ++j) {
+            t[i + j] = _mm512_madd52lo_epu64(t[i + j], a[i], b[j]);
+            t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a[i], b[j]);
+        }
+    }
+
+    for (int32_t k = 0; k < LIMBS; ++k) {
+        __m512i m = _mm512_madd52lo_epu64(zero, t[k], inv);
+        if (k == LIMBS - 1) m = _mm512_and_si512(m, _mm512_set1_epi64(MASK48));
+        for (int32_t j = 0; j < LIMBS; ++j) {
+            t[k + j] = _mm512_madd52lo_epu64(t[k + j], m, p[j]);
+            t[k + j + 1] = _mm512_madd52hi_epu64(t[k + j + 1], m, p[j]);
+        }
+        if (k < LIMBS - 1) t[k + 1] = _mm512_add_epi64(t[k + 1], _mm512_srli_epi64(t[k], 52));
+    }
+
+    for (int32_t k = LIMBS - 1; k < 2 * LIMBS - 1; ++k) {
+        t[k + 1] = _mm512_add_epi64(t[k + 1], _mm512_srli_epi64(t[k], 52));
+        t[k] = _mm512_and_si512(t[k], mask52);
+    }
+
+    // the low 256 bits are now zero, the result starts at bit 48 of limb 4
+    Limbs r;
+    for (int32_t k = 0; k < LIMBS; ++k) {
+        const __m512i high = _mm512_slli_epi64(_mm512_and_si512(t[LIMBS + k], _mm512_set1_epi64(MASK48)), 4);
+        r[k] = _mm512_or_si512(_mm512_srli_epi64(t[LIMBS - 1 + k], 48), high);
+    }
+    return subtract_modulus(r, p);
+}
+
+JUBJUB_TARGET_AVX512_IFMA void apply(Op op, const Columns &out, const ConstColumns &a, const ConstColumns &b, size_t n,
+                                     const std::array<uint64_t, Fr::WIDTH> &modulus, uint64_t inv) {
+    const Limbs p = broadcast(modulus);
+    const __m512i inv52 = _mm512_set1_epi64(static_cast<int64_t>(inv & MASK52));
+    for (size_t i = 0; i < n; i += 8) {
+        const Limbs x = load(a, i);
+        switch (op) {
+            case Op::ADD:
+                store(out, i, add(x, load(b, i), p));
+                break;
+            case Op::SUB:
+                store(out, i, sub(x, load(b, i), p));
+                break;
+            case Op::MUL:
+                store(out, i, mul(x, load(b, i), p, inv52));
+                break;
+            case Op::SQUARE:
+                store(out, i, mul(x, x, p, inv52));
+                break;
+        }
+    }
+}
+
+} // namespace avx512_ifma
+
+#endif
+
+} // namespace
+
+FrVec::FrVec(size_t size) :
+        length{size},
+        stride{(size + FrVec::LANES - 1) / FrVec::LANES * FrVec::LANES},
+        limbs(Fr::WIDTH * this->stride, 0) {}
+
+FrVec::FrVec(size_t size, const Fr &value) : FrVec(size) {
+    for (size_t i = 0; i < size; ++i)
+        this->set(i, value);
+}
+
+FrVec::FrVec(std::span<const Fr> values) : FrVec(values.size()) {
+    for (size_t i = 0; i < values.size(); ++i)
+        this->set(i, values[i]);
+}
+
+void FrVec::add(FrVec &out, const FrVec &lhs, const FrVec &rhs, Backend backend) {
+    FrVec::apply(Op::ADD, out, lhs, rhs, backend);
+}
+
+void FrVec::sub(FrVec &out, const FrVec &lhs, const FrVec &rhs, Backend backend) {
+    FrVec::apply(Op::SUB, out, lhs, rhs, backend);
+}
+
+void FrVec::mul(FrVec &out, const FrVec &lhs, const FrVec &rhs, Backend backend) {
+    FrVec::apply(Op::MUL, out, lhs, rhs, backend);
+}
+
+void FrVec::square(FrVec &out, const FrVec &value, Backend backend) {
+    FrVec::apply(Op::SQUARE, out, value, value, backend);
+}
+
+void FrVec::apply(Op op, FrVec &out, const FrVec &lhs, const FrVec &rhs, Backend backend) {
+    assert(lhs.length == rhs.length);
+    assert(FrVec::is_supported(backend));
+    if (out.length != lhs.length) out = FrVec(lhs.length);
+
+    const Columns r = {out.column(0), out.column(1), out.column(2), out.column(3)};
+    const ConstColumns a = {lhs.column(0), lhs.column(1), lhs.column(2), lhs.column(3)};
+    const ConstColumns b = {rhs.column(0), rhs.column(1), rhs.column(2), rhs.column(3)};
+
+    switch (backend) {
+#ifdef JUBJUB_FR_VEC_X86
+        case Backend::AVX512_IFMA:
+            avx512_ifma::apply(op, r, a, b, lhs.stride, Fr::MODULUS_LIMBS, Fr::INV);
+            return;
+        case Backend::AVX2:
+            avx2::apply(op, r, a, b, lhs.stride, Fr::MODULUS_LIMBS, Fr::INV);
+            return;
+#endif
+        default:
+            break;
+    }
+
+    // one element at a time through the scalar kernels
+    for (size_t i = 0; i < lhs.length; ++i) {
+        const Fr x = lhs.get(i);
+        const Fr y = rhs.get(i);
+        switch (op) {
+            case Op::ADD:
+                out.set(i, x + y);
+                break;
+            case Op::SUB:
+                out.set(i, x - y);
+                break;
+            case Op::MUL:
+                out.set(i, x * y);
+                break;
+            case Op::SQUARE:
+                out.set(i, x.square());
+                break;
+        }
+    }
+}
+
+FrVec::Backend FrVec::detect() noexcept {
+#ifdef JUBJUB_FR_VEC_X86
+    if (FrVec::is_supported(Backend::AVX512_IFMA)) return Backend::AVX512_IFMA;
+    // 32-bit multiplies lose to the scalar MULX/ADX kernels, so AVX2 is only picked on CPUs without them
+    if (FrVec::is_supported(Backend::AVX2) && montgomery::active() != montgomery::Backend::MULX_ADX)
+        return Backend::AVX2;
+#endif
+    return Backend::PORTABLE;
+}
+
+bool FrVec::is_supported(Backend backend) noexcept {
+    switch (backend) {
+#ifdef JUBJUB_FR_VEC_X86
+        case Backend::AVX2:
+            return __builtin_cpu_supports("avx2");
+        case Backend::AVX512_IFMA:
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+#endif
+        case Backend::PORTABLE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Fr FrVec::get(size_t index) const {
+    assert(index < this->length);
+    return Fr{{this->column(0)[index], this->column(1)[index], this->column(2)[index], this->column(3)[index]}};
+}
+
+void FrVec::set(size_t index, const Fr &value) {
+    assert(index < this->length);
+    for (size_t k = 0; k < Fr::WIDTH; ++k)
+        this->column(k)[index] = value.data[k];
+}
+
+std::vector<Fr> FrVec::to_vector() const {
+    std::vector<Fr> values(this->length);
+    for (size_t i = 0; i < this->length; ++i)
+        values[i] = this->get(i);
+    return values;
+}
+
+FrVec FrVec::square() const {
+    FrVec out;
+    FrVec::square(out, *this);
+    return out;
+}
+
+FrVec &FrVec::operator+=(const FrVec &rhs) {
+    FrVec::add(*this, *this, rhs);
+    return *this;
+}
+
+FrVec &FrVec::operator-=(const FrVec &rhs) {
+    FrVec::sub(*this, *this, rhs);
+    return *this;
+}
+
+FrVec &FrVec::operator*=(const FrVec &rhs) {
+    FrVec::mul(*this, *this, rhs);
+    return *this;
+}
+
+} // namespace jubjub::field
\ No newline at end of file
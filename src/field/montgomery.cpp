@@ -0,0 +1,21 @@
+#include "field/montgomery.h"
+
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+#include <cpuid.h>
+#endif
+
+namespace jubjub::field::montgomery {
+
+Backend detect() noexcept {
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+    uint32_t eax, ebx, ecx, edx;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        const bool bmi2 = (ebx >> 8) & 1;
+        const bool adx = (ebx >> 19) & 1;
+        if (bmi2 && adx) return Backend::MULX_ADX;
+    }
+#endif
+    return Backend::PORTABLE;
+}
+
+} // namespace jubjub::field::montgomery
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "field/recode.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+namespace jubjub::field::recode {
+
+namespace {
+
+/// The value with a zero limb on top, so that any 64-bit window below bit 256 can be read without branches.
+using Padded = std::array<uint64_t, 5>;
+
+Padded pad(const std::array<uint64_t, 4> &value) {
+    return {value[0], value[1], value[2], value[3], 0};
+}
+
+/// Returns the 64 bits of `value` starting at bit `pos`, for `pos` below 256.
+uint64_t bits_at(const Padded &value, size_t pos) {
+    const size_t limb = pos / 64, shift = pos % 64;
+    // the split shift keeps the high part well defined when `shift` is zero
+    return (value[limb] >> shift) | ((value[limb + 1] << 1) << (63 - shift));
+}
+
+/// For every width, the sum of `2^(width-1) * 2^(width * i)` over all digits but the top one.
+constexpr std::array<std::array<uint64_t, 4>, 9> RADIX_OFFSETS = []() {
+    std::array<std::array<uint64_t, 4>, 9> offsets{};
+    for (uint8_t width = 2; width <= 8; ++width) {
+        for (size_t i = 0; i + 1 < radix_2w_length(width); ++i) {
+            const size_t pos = i * width + width - 1;
+            offsets[width][pos / 64] |= uint64_t{1} << (pos % 64);
+        }
+    }
+    return offsets;
+}();
+
+} // namespace
+
+size_t wnaf(const std::array<uint64_t, 4> &value, uint8_t width, std::span<int8_t, MAX_DIGITS> digits) {
+    assert(width >= 2 && width <= 8);
+
+    const Padded padded = pad(value);
+    const uint64_t window_mask = (uint64_t{1} << width) - 1;
+
+    std::fill(digits.begin(), digits.end(), 0);
+
+    size_t length = 0;
+    uint64_t carry = 0;
+    size_t pos = 0;
+    // `buffer` caches the bits from `pos` upwards, at least `available` of which are valid
+    uint64_t buffer = bits_at(padded, 0);
+    size_t available = 64;
+    while (pos < MAX_DIGITS) {
+        if (available < 2 * 8) {
+            buffer = bits_at(padded, pos);
+            available = 64;
+        }
+
+        // bits equal to the carry give even windows and leave the carry in place, so the whole run is skipped
+        const auto run = static_cast<size_t>(std::countr_zero(buffer ^ (0 - carry)));
+        if (run > available - 8) {
+            pos += available - 8;
+            available = 0;
+            continue;
+        }
+        pos += run;
+        buffer >>= run;
+        if (pos >= MAX_DIGITS) break;
+
+        // the window is odd and below 2^width, its top bit decides whether it is taken as negative
+        const uint64_t window = carry + (buffer & window_mask);
+        carry = window >> (width - 1);
+        digits[pos] = static_cast<int8_t>(static_cast<int64_t>(window) - static_cast<int64_t>(carry << width));
+        length = pos + 1;
+        pos += width;
+        buffer >>= width;
+        available -= run + width;
+    }
+    return length;
+}
+
+size_t radix_2w(const std::array<uint64_t, 4> &value, uint8_t width, std::span<int8_t, MAX_DIGITS> digits) {
+    assert(width >= 2 && width <= 8);
+
+    const size_t length = radix_2w_length(width);
+    const uint64_t window_mask = (uint64_t{1} << width) - 1;
+    const auto half = static_cast<int64_t>(uint64_t{1} << (width - 1));
+
+    // adding half of the radix to every digit but the top one turns the signed recoding into a plain unsigned
+    // one: each digit is then read independently and recentred, with no carry chain between digits
+    const std::array<uint64_t, 4> &offset = RADIX_OFFSETS[width];
+
+    Padded shifted{};
+    unsigned __int128 carry = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        carry += static_cast<unsigned __int128>(value[i]) + offset[i];
+        shifted[i] = static_cast<uint64_t>(carry);
+        carry >>= 64;
+    }
+
+    std::fill(digits.begin(), digits.end(), 0);
+    for (size_t i = 0; i + 1 < length; ++i)
+        digits[i] = static_cast<int8_t>(static_cast<int64_t>(bits_at(shifted, i * width) & window_mask) - half);
+    digits[length - 1] = static_cast<int8_t>(bits_at(shifted, (length - 1) * width) & window_mask);
+    return length;
+}
+
+} // namespace jubjub::field::recode
\ No newline at end of file
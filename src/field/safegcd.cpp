@@ -0,0 +1,171 @@
+#include "field/safegcd.h"
+
+namespace jubjub::field::safegcd {
+
+namespace {
+
+using int128_t = __int128;
+
+/// The 2x2 transition matrix of a batch of divsteps, scaled by 2^62.
+struct Transition {
+    int64_t u;
+    int64_t v;
+    int64_t q;
+    int64_t r;
+};
+
+std::array<uint64_t, 4> from_signed62(const Signed62 &a) {
+    const auto v0 = static_cast<uint64_t>(a.v[0]);
+    const auto v1 = static_cast<uint64_t>(a.v[1]);
+    const auto v2 = static_cast<uint64_t>(a.v[2]);
+    const auto v3 = static_cast<uint64_t>(a.v[3]);
+    const auto v4 = static_cast<uint64_t>(a.v[4]);
+    return {v0 | (v1 << 62), (v1 >> 2) | (v2 << 60), (v2 >> 4) | (v3 << 58), (v3 >> 6) | (v4 << 56)};
+}
+
+/// Performs 59 constant-time divsteps on the low bits of `f` and `g`, returning the updated `zeta = -(delta + 1/2)`.
+int64_t divsteps_59(int64_t zeta, uint64_t f0, uint64_t g0, Transition &t) {
+    // the matrix starts as the identity scaled by 2^3, so that 59 doublings end at a scale of 2^62
+    uint64_t u = 8, v = 0, q = 0, r = 8;
+    uint64_t f = f0, g = g0;
+
+    for (int i = 3; i < 62; ++i) {
+        uint64_t mask1 = static_cast<uint64_t>(zeta >> 63);
+        const uint64_t mask2 = -(g & 1);
+
+        const uint64_t x = (f ^ mask1) - mask1;
+        const uint64_t y = (u ^ mask1) - mask1;
+        const uint64_t z = (v ^ mask1) - mask1;
+
+        g += x & mask2;
+        q += y & mask2;
+        r += z & mask2;
+
+        mask1 &= mask2;
+        zeta = (zeta ^ static_cast<int64_t>(mask1)) - 1;
+
+        f += g & mask1;
+        u += q & mask1;
+        v += r & mask1;
+
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+
+    t.u = static_cast<int64_t>(u);
+    t.v = static_cast<int64_t>(v);
+    t.q = static_cast<int64_t>(q);
+    t.r = static_cast<int64_t>(r);
+    return zeta;
+}
+
+/// Computes `(t * [d, e] + modulus * [md, me]) / 2^62`, keeping `d` and `e` in the range `(-2 * modulus, modulus)`.
+void update_de_62(Signed62 &d, Signed62 &e, const Transition &t, const Modulus &modulus) {
+    const std::array<int64_t, 5> &m = modulus.modulus.v;
+    const int64_t u = t.u, v = t.v, q = t.q, r = t.r;
+
+    const int64_t sd = d.v[4] >> 63;
+    const int64_t se = e.v[4] >> 63;
+    int64_t md = (u & sd) + (v & se);
+    int64_t me = (q & sd) + (r & se);
+
+    int128_t cd = static_cast<int128_t>(u) * d.v[0] + static_cast<int128_t>(v) * e.v[0];
+    int128_t ce = static_cast<int128_t>(q) * d.v[0] + static_cast<int128_t>(r) * e.v[0];
+
+    // choose md and me so that the bottom 62 bits of the sum vanish
+    md -= static_cast<int64_t>((modulus.modulus_inv62 * static_cast<uint64_t>(cd) + md) & M62);
+    me -= static_cast<int64_t>((modulus.modulus_inv62 * static_cast<uint64_t>(ce) + me) & M62);
+
+    cd += static_cast<int128_t>(m[0]) * md;
+    ce += static_cast<int128_t>(m[0]) * me;
+    cd >>= 62;
+    ce >>= 62;
+
+    for (int i = 1; i < 5; ++i) {
+        cd += static_cast<int128_t>(u) * d.v[i] + static_cast<int128_t>(v) * e.v[i];
+        ce += static_cast<int128_t>(q) * d.v[i] + static_cast<int128_t>(r) * e.v[i];
+        cd += static_cast<int128_t>(m[i]) * md;
+        ce += static_cast<int128_t>(m[i]) * me;
+        d.v[i - 1] = static_cast<int64_t>(static_cast<uint64_t>(cd) & M62);
+        e.v[i - 1] = static_cast<int64_t>(static_cast<uint64_t>(ce) & M62);
+        cd >>= 62;
+        ce >>= 62;
+    }
+
+    d.v[4] = static_cast<int64_t>(cd);
+    e.v[4] = static_cast<int64_t>(ce);
+}
+
+/// Computes `t * [f, g] / 2^62`.
+void update_fg_62(Signed62 &f, Signed62 &g, const Transition &t) {
+    const int64_t u = t.u, v = t.v, q = t.q, r = t.r;
+
+    int128_t cf = static_cast<int128_t>(u) * f.v[0] + static_cast<int128_t>(v) * g.v[0];
+    int128_t cg = static_cast<int128_t>(q) * f.v[0] + static_cast<int128_t>(r) * g.v[0];
+    cf >>= 62;
+    cg >>= 62;
+
+    for (int i = 1; i < 5; ++i) {
+        cf += static_cast<int128_t>(u) * f.v[i] + static_cast<int128_t>(v) * g.v[i];
+        cg += static_cast<int128_t>(q) * f.v[i] + static_cast<int128_t>(r) * g.v[i];
+        f.v[i - 1] = static_cast<int64_t>(static_cast<uint64_t>(cf) & M62);
+        g.v[i - 1] = static_cast<int64_t>(static_cast<uint64_t>(cg) & M62);
+        cf >>= 62;
+        cg >>= 62;
+    }
+
+    f.v[4] = static_cast<int64_t>(cf);
+    g.v[4] = static_cast<int64_t>(cg);
+}
+
+/// Brings `r` from `(-2 * modulus, modulus)` into `[0, modulus)`, negating it first if `sign` is negative.
+void normalize_62(Signed62 &r, int64_t sign, const Modulus &modulus) {
+    const std::array<int64_t, 5> &m = modulus.modulus.v;
+    const auto m62 = static_cast<int64_t>(M62);
+
+    int64_t cond_add = r.v[4] >> 63;
+    for (int i = 0; i < 5; ++i)
+        r.v[i] += m[i] & cond_add;
+
+    const int64_t cond_negate = sign >> 63;
+    for (int i = 0; i < 5; ++i)
+        r.v[i] = (r.v[i] ^ cond_negate) - cond_negate;
+
+    for (int i = 0; i < 4; ++i) {
+        r.v[i + 1] += r.v[i] >> 62;
+        r.v[i] &= m62;
+    }
+
+    cond_add = r.v[4] >> 63;
+    for (int i = 0; i < 5; ++i)
+        r.v[i] += m[i] & cond_add;
+
+    for (int i = 0; i < 4; ++i) {
+        r.v[i + 1] += r.v[i] >> 62;
+        r.v[i] &= m62;
+    }
+}
+
+} // namespace
+
+std::array<uint64_t, 4> invert(const std::array<uint64_t, 4> &value, const Modulus &modulus) {
+    Signed62 d{{0, 0, 0, 0, 0}};
+    Signed62 e{{1, 0, 0, 0, 0}};
+    Signed62 f = modulus.modulus;
+    Signed62 g = to_signed62(value);
+    int64_t zeta = -1;
+
+    for (int i = 0; i < 10; ++i) {
+        Transition t{};
+        zeta = divsteps_59(zeta, static_cast<uint64_t>(f.v[0]), static_cast<uint64_t>(g.v[0]), t);
+        update_de_62(d, e, t, modulus);
+        update_fg_62(f, g, t);
+    }
+
+    // g has reached zero and f is +-1, so d holds +-value^-1
+    normalize_62(d, f.v[4], modulus);
+    return from_signed62(d);
+}
+
+} // namespace jubjub::field::safegcd
\ No newline at end of file
@@ -6,22 +6,22 @@
 namespace jubjub::group {
 
 using bls12_381::scalar::Scalar;
+using field::Fq;
 
-using constant::EDWARDS_D1;
 
-Affine::Affine() : x{Scalar::zero()}, y{Scalar::one()} {}
+Affine::Affine() : x{Fq::zero()}, y{Fq::one()} {}
 
 Affine::Affine(const Affine &affine) = default;
 
 Affine::Affine(Affine &&affine) noexcept = default;
 
-Affine::Affine(const Extended &extended) : x{extended.get_x()}, y{extended.get_y()} {
-    const Scalar z_inv = extended.get_z().invert().value();
+Affine::Affine(const Extended &extended) : x{extended.x}, y{extended.y} {
+    const Fq z_inv = extended.z.invert().value();
     this->x *= z_inv;
     this->y *= z_inv;
 }
 
-Affine::Affine(Scalar x, Scalar y) : x{std::move(x)}, y{std::move(y)} {}
+Affine::Affine(Scalar x, Scalar y) : x{Fq{x}}, y{Fq{y}} {}
 
 Affine Affine::identity() noexcept {
     return Affine{};
@@ -39,7 +39,7 @@ std::optional<Affine> Affine::from_bytes(const std::array<uint8_t, Scalar::BYTE_
     const Scalar y2 = y.square();
 
     Scalar x = y2 - Scalar::one();
-    const auto source = (Scalar::one() + EDWARDS_D1 * y2).invert();
+    const auto source = (Scalar::one() + constant::fq::EDWARDS_D1.to_scalar() * y2).invert();
     if (source.has_value())
         x *= source.value();
     else
@@ -60,14 +60,14 @@ std::optional<Affine> Affine::from_bytes(const std::array<uint8_t, Scalar::BYTE_
 }
 
 std::array<uint8_t, Scalar::BYTE_SIZE> Affine::to_bytes() const {
-    const std::array<uint8_t, 32> x_bytes = this->x.to_bytes();
-    std::array<uint8_t, 32> res = this->y.to_bytes();
+    const std::array<uint8_t, 32> x_bytes = this->x.to_scalar().to_bytes();
+    std::array<uint8_t, 32> res = this->y.to_scalar().to_bytes();
     res[31] |= x_bytes[0] << 7;
     return res;
 }
 
 bool Affine::is_identity() const {
-    return this->x == Scalar::zero() && this->y == Scalar::one();
+    return this->x.is_zero() && this->y == Fq::one();
 }
 
 bool Affine::is_small_order() const {
@@ -84,9 +84,9 @@ bool Affine::is_prime_order() const {
 }
 
 bool Affine::is_on_curve() const {
-    const Scalar x2 = this->x.square();
-    const Scalar y2 = this->y.square();
-    return (y2 - x2 == Scalar::one() + EDWARDS_D1 * x2 * y2);
+    const Fq x2 = this->x.square();
+    const Fq y2 = this->y.square();
+    return (y2 - x2 == Fq::one() + constant::fq::EDWARDS_D1 * x2 * y2);
 }
 
 Extended Affine::mul_by_cofactor() const {
@@ -94,11 +94,11 @@ Extended Affine::mul_by_cofactor() const {
 }
 
 bls12_381::scalar::Scalar Affine::get_x() const {
-    return this->x;
+    return this->x.to_scalar();
 }
 
 bls12_381::scalar::Scalar Affine::get_y() const {
-    return this->y;
+    return this->y.to_scalar();
 }
 
 Affine Affine::operator-() const {
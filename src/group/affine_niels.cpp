@@ -5,59 +5,64 @@
 #include "group/affine.h"
 #include "group/extended.h"
 #include "group/constants.h"
+#include "group/window.h"
 
 namespace jubjub::group {
 
 using bls12_381::scalar::Scalar;
 
+using field::Fq;
 using field::Fr;
-using constant::EDWARDS_D2;
 
-AffineNiels::AffineNiels() : y_plus_x{Scalar::one()}, y_minus_x{Scalar::one()}, t2d{Scalar::zero()} {}
+AffineNiels::AffineNiels() : y_plus_x{Fq::one()}, y_minus_x{Fq::one()}, t2d{Fq::zero()} {}
 
 AffineNiels::AffineNiels(const AffineNiels &point) = default;
 
 AffineNiels::AffineNiels(AffineNiels &&point) noexcept = default;
 
 AffineNiels::AffineNiels(const Affine &affine)
-        : y_plus_x{affine.get_y() + affine.get_x()}, y_minus_x{affine.get_y() - affine.get_x()},
-          t2d{affine.get_x() * affine.get_y() * EDWARDS_D2} {}
+        : y_plus_x{affine.y + affine.x}, y_minus_x{affine.y - affine.x},
+          t2d{constant::fq::EDWARDS_D2 * affine.x.mul_lazy(affine.y)} {}
+
+AffineNiels::AffineNiels(Fq y_plus_x, Fq y_minus_x, Fq t2d)
+        : y_plus_x{std::move(y_plus_x)}, y_minus_x{std::move(y_minus_x)}, t2d{std::move(t2d)} {}
 
 AffineNiels AffineNiels::identity() noexcept {
     return AffineNiels{};
 }
 
+AffineNiels AffineNiels::conditional_select(const AffineNiels &a, const AffineNiels &b, bool choice) {
+    return AffineNiels{
+            Fq::conditional_select(a.y_plus_x, b.y_plus_x, choice),
+            Fq::conditional_select(a.y_minus_x, b.y_minus_x, choice),
+            Fq::conditional_select(a.t2d, b.t2d, choice),
+    };
+}
+
 Extended AffineNiels::multiply(const std::array<uint8_t, 32> &by) const {
-    const AffineNiels zero = AffineNiels::identity();
-    Extended acc = Extended::identity();
-
-    for (auto iter = by.rbegin(); iter != by.rend(); iter++) {
-        for (int i = 7; i >= 0; --i) {
-            if (iter == by.rbegin() && i > 3) continue;
-            bool bit = (*iter >> i) & 1;
-            acc = acc.doubles();
-            if (bit) {
-                acc += *this;
-            } else {
-                acc += zero;
-            }
-        }
-    }
-    return acc;
+    return window::multiply(Extended::identity() + *this, by);
 }
 
 bls12_381::scalar::Scalar AffineNiels::get_y_plus_x() const {
-    return this->y_plus_x;
+    return this->y_plus_x.to_scalar();
 }
 
 bls12_381::scalar::Scalar AffineNiels::get_y_minus_x() const {
-    return this->y_minus_x;
+    return this->y_minus_x.to_scalar();
 }
 
 bls12_381::scalar::Scalar AffineNiels::get_t2d() const {
-    return this->t2d;
+    return this->t2d.to_scalar();
 }
 
+AffineNiels AffineNiels::operator-() const {
+    return AffineNiels{this->y_minus_x, this->y_plus_x, -this->t2d};
+}
+
+AffineNiels &AffineNiels::operator=(const AffineNiels &rhs) = default;
+
+AffineNiels &AffineNiels::operator=(AffineNiels &&rhs) noexcept = default;
+
 Extended operator+(const AffineNiels &lhs, const Extended &rhs) {
     return Extended{rhs} += lhs;
 }
@@ -7,24 +7,27 @@
 #include "group/affine_niels.h"
 #include "group/completed.h"
 #include "group/extended_niels.h"
+#include "group/projective.h"
+#include "group/window.h"
+#include "group/wnaf.h"
 
 namespace jubjub::group {
 
 using bls12_381::scalar::Scalar;
+using field::Fq;
 using constant::FR_MODULUS_BYTES;
 
-Extended::Extended()
-        : x{Scalar::zero()}, y{Scalar::one()}, z{Scalar::one()}, t1{Scalar::zero()}, t2{Scalar::zero()} {}
+Extended::Extended() : x{Fq::zero()}, y{Fq::one()}, z{Fq::one()}, t1{Fq::zero()}, t2{Fq::zero()} {}
 
 Extended::Extended(const Extended &extended) = default;
 
 Extended::Extended(Extended &&extended) noexcept = default;
 
 Extended::Extended(const Affine &affine)
-        : x{affine.get_x()}, y{affine.get_y()}, z{Scalar::one()}, t1{affine.get_x()}, t2{affine.get_y()} {}
+        : x{affine.x}, y{affine.y}, z{Fq::one()}, t1{affine.x}, t2{affine.y} {}
 
 Extended::Extended(Affine &&affine) noexcept
-        : x{affine.get_x()}, y{affine.get_y()}, z{Scalar::one()}, t1{affine.get_x()}, t2{affine.get_y()} {}
+        : x{affine.x}, y{affine.y}, z{Fq::one()}, t1{affine.x}, t2{affine.y} {}
 
 Extended::Extended(const Completed &completed)
         : x{completed.x * completed.t}, y{completed.y * completed.z}, z{completed.z * completed.t},
@@ -32,22 +35,22 @@ Extended::Extended(const Completed &completed)
 
 Extended::Extended(bls12_381::scalar::Scalar x, bls12_381::scalar::Scalar y, bls12_381::scalar::Scalar z,
                    bls12_381::scalar::Scalar t1, bls12_381::scalar::Scalar t2)
-        : x{std::move(x)}, y{std::move(y)}, z{std::move(z)}, t1{std::move(t1)}, t2{std::move(t2)} {}
+        : x{Fq{x}}, y{Fq{y}}, z{Fq{z}}, t1{Fq{t1}}, t2{Fq{t2}} {}
 
 Extended Extended::identity() noexcept {
     return Extended{};
 }
 
 bool Extended::is_identity() const {
-    return (this->x == Scalar::zero()) && (this->y == this->z);
+    return this->x.is_zero() && (this->y == this->z);
 }
 
 bool Extended::is_small_order() const {
-    return this->doubles().doubles().x == Scalar::zero();
+    return Projective{*this}.doubles().doubles().x.is_zero();
 }
 
 bool Extended::is_torsion_free() const {
-    return this->multiply(FR_MODULUS_BYTES).is_identity();
+    return this->multiply_vartime(FR_MODULUS_BYTES).is_identity();
 }
 
 bool Extended::is_prime_order() const {
@@ -56,53 +59,86 @@ bool Extended::is_prime_order() const {
 
 bool Extended::is_on_curve() const {
     const Affine affine{*this};
-    return this->z != Scalar::zero()
+    return !this->z.is_zero()
            && affine.is_on_curve()
-           && (affine.get_x() * affine.get_y() * this->z == this->t1 * this->t2);
+           && (affine.x * affine.y * this->z == this->t1 * this->t2);
 }
 
 std::tuple<Scalar, Scalar> Extended::to_hash_inputs() const {
     const Affine p{*this};
-    return {p.get_x(), p.get_y()};
+    return {p.x.to_scalar(), p.y.to_scalar()};
 }
 
 Extended Extended::mul_by_cofactor() const {
-    return this->doubles().doubles().doubles();
+    return this->double_n(3);
+}
+
+// The point formulas below, and the `Projective` doubling behind `doubles`, are fused with the conversion out of
+// the completed form and keep some intermediates in the redundant form of `Fq::add_lazy`, `Fq::sub_lazy` and
+// `Fq::mul_lazy`, only ever feeding them to a multiplication as its right operand. Per operation (M: multiplications
+// and squarings, R: final reductions):
+//
+//   formula                 completed form     fused
+//   doubles                 7M, 13R            7M, 12R
+//   += ExtendedNiels        8M, 15R            8M, 11R
+//   += AffineNiels          7M, 14R            7M, 10R
+//   += Extended             10M, 19R           10M, 14R
+//
+// A reduction is the conditional subtraction (or add-back) closing every `Fq` operation, it sits on the critical
+// path of each multiplication that consumes its result.
+Extended Extended::doubles() const {
+    return Extended{Projective{*this}.double_completed()};
 }
 
-Extended Extended::doubles() const {
-    const Scalar xx = this->x.square();
-    const Scalar yy = this->y.square();
-    const Scalar zz2 = this->z.square().doubles();
-    const Scalar xy2 = (this->x + this->y).square();
-    const Scalar yy_plus_xx = yy + xx;
-    const Scalar yy_minus_xx = yy - xx;
-    const Completed completed{xy2 - yy_plus_xx, yy_plus_xx, yy_minus_xx, zz2 - yy_minus_xx};
-    return Extended{completed};
+Extended Extended::double_n(uint32_t k) const {
+    if (k == 0) return *this;
+
+    Projective acc{*this};
+    for (uint32_t i = 1; i < k; ++i)
+        acc = acc.doubles();
+    return Extended{acc.double_completed()};
 }
 
 Extended Extended::multiply(const std::array<uint8_t, 32> &by) const {
-    return ExtendedNiels{*this}.multiply(by);
+    return window::multiply(*this, by);
+}
+
+Extended Extended::multiply_vartime(const field::Fr &by) const {
+    const std::array<uint8_t, 32> bytes = by.to_bytes();
+    return this->multiply_vartime(bytes);
+}
+
+Extended Extended::multiply_vartime(const std::array<uint8_t, 32> &by) const {
+    return wnaf::multiply(*this, window::load_scalar(by));
+}
+
+Extended Extended::double_scalar_mul(const field::Fr &a, const Extended &p, const field::Fr &b, const Extended &q) {
+    return window::double_multiply(a.to_bytes(), p, b.to_bytes(), q);
+}
+
+Extended Extended::double_scalar_mul_vartime(const field::Fr &a, const Extended &p, const field::Fr &b,
+                                             const Extended &q) {
+    return wnaf::double_multiply(window::load_scalar(a.to_bytes()), p, window::load_scalar(b.to_bytes()), q);
 }
 
 bls12_381::scalar::Scalar Extended::get_x() const {
-    return this->x;
+    return this->x.to_scalar();
 }
 
 bls12_381::scalar::Scalar Extended::get_y() const {
-    return this->y;
+    return this->y.to_scalar();
 }
 
 bls12_381::scalar::Scalar Extended::get_z() const {
-    return this->z;
+    return this->z.to_scalar();
 }
 
 bls12_381::scalar::Scalar Extended::get_t1() const {
-    return this->t1;
+    return this->t1.to_scalar();
 }
 
 bls12_381::scalar::Scalar Extended::get_t2() const {
-    return this->t2;
+    return this->t2.to_scalar();
 }
 
 Extended Extended::operator-() const {
@@ -114,21 +150,19 @@ Extended &Extended::operator=(const Extended &rhs) = default;
 Extended &Extended::operator=(Extended &&rhs) noexcept = default;
 
 Extended &Extended::operator+=(const AffineNiels &rhs) {
-    const Scalar a = (this->y - this->x) * rhs.get_y_minus_x();
-    const Scalar b = (this->y + this->x) * rhs.get_y_plus_x();
-    const Scalar c = this->t1 * this->t2 * rhs.get_t2d();
-    const Scalar d = this->z.doubles();
-    *this = Extended{Completed{b - a, b + a, d + c, d - c}};
-    return *this;
+    const Fq a = rhs.y_minus_x * this->y.sub_lazy(this->x);
+    const Fq b = rhs.y_plus_x * this->y.add_lazy(this->x);
+    const Fq c = rhs.t2d * this->t1.mul_lazy(this->t2);
+    const Fq d = this->z.doubles();
+    return this->assign_completed(b - a, d.sub_lazy(c), d + c, b + a);
 }
 
 Extended &Extended::operator-=(const AffineNiels &rhs) {
-    const Scalar a = (this->y - this->x) * rhs.get_y_plus_x();
-    const Scalar b = (this->y + this->x) * rhs.get_y_minus_x();
-    const Scalar c = this->t1 * this->t2 * rhs.get_t2d();
-    const Scalar d = this->z.doubles();
-    *this = Extended{Completed{b - a, b + a, d - c, d + c}};
-    return *this;
+    const Fq a = rhs.y_plus_x * this->y.sub_lazy(this->x);
+    const Fq b = rhs.y_minus_x * this->y.add_lazy(this->x);
+    const Fq c = rhs.t2d * this->t1.mul_lazy(this->t2);
+    const Fq d = this->z.doubles();
+    return this->assign_completed(b - a, d.add_lazy(c), d - c, b + a);
 }
 
 Extended &Extended::operator+=(const Affine &rhs) {
@@ -142,34 +176,44 @@ Extended &Extended::operator-=(const Affine &rhs) {
 }
 
 Extended &Extended::operator+=(const Extended &rhs) {
-    *this += ExtendedNiels{rhs};
-    return *this;
+    const Fq a = (this->y - this->x) * rhs.y.sub_lazy(rhs.x);
+    const Fq b = (this->y + this->x) * rhs.y.add_lazy(rhs.x);
+    const Fq c = constant::fq::EDWARDS_D2 * (this->t1 * this->t2).mul_lazy(rhs.t1.mul_lazy(rhs.t2));
+    const Fq d = (this->z * rhs.z).doubles();
+    return this->assign_completed(b - a, d.sub_lazy(c), d + c, b + a);
 }
 
 Extended &Extended::operator-=(const Extended &rhs) {
-    *this -= ExtendedNiels{rhs};
-    return *this;
+    // -rhs swaps y - x with y + x and negates t1
+    const Fq a = (this->y - this->x) * rhs.y.add_lazy(rhs.x);
+    const Fq b = (this->y + this->x) * rhs.y.sub_lazy(rhs.x);
+    const Fq c = constant::fq::EDWARDS_D2 * (this->t1 * this->t2).mul_lazy(rhs.t1.mul_lazy(rhs.t2));
+    const Fq d = (this->z * rhs.z).doubles();
+    return this->assign_completed(b - a, d.add_lazy(c), d - c, b + a);
 }
 
 Extended &Extended::operator+=(const ExtendedNiels &rhs) {
-    const Scalar a = (this->y - this->x) * rhs.get_y_minus_x();
-    const Scalar b = (this->y + this->x) * rhs.get_y_plus_x();
-    const Scalar c = this->t1 * this->t2 * rhs.get_t2d();
-    const Scalar d = (this->z * rhs.get_z()).doubles();
-
-    const Completed cp{b - a, b + a, d + c, d - c};
-    const Extended ext{cp};
-
-    *this = ext;
-    return *this;
+    const Fq a = rhs.y_minus_x * this->y.sub_lazy(this->x);
+    const Fq b = rhs.y_plus_x * this->y.add_lazy(this->x);
+    const Fq c = rhs.t2d * this->t1.mul_lazy(this->t2);
+    const Fq d = (this->z * rhs.z).doubles();
+    return this->assign_completed(b - a, d.sub_lazy(c), d + c, b + a);
 }
 
 Extended &Extended::operator-=(const ExtendedNiels &rhs) {
-    const Scalar a = (this->y - this->x) * rhs.get_y_plus_x();
-    const Scalar b = (this->y + this->x) * rhs.get_y_minus_x();
-    const Scalar c = this->t1 * this->t2 * rhs.get_t2d();
-    const Scalar d = (this->z * rhs.get_z()).doubles();
-    *this = Extended{Completed{b - a, b + a, d - c, d + c}};
+    const Fq a = rhs.y_plus_x * this->y.sub_lazy(this->x);
+    const Fq b = rhs.y_minus_x * this->y.add_lazy(this->x);
+    const Fq c = rhs.t2d * this->t1.mul_lazy(this->t2);
+    const Fq d = (this->z * rhs.z).doubles();
+    return this->assign_completed(b - a, d.add_lazy(c), d - c, b + a);
+}
+
+Extended &Extended::assign_completed(const Fq &e, const Fq &f, const Fq &g, const Fq &h) {
+    this->x = e * f;
+    this->y = h * g;
+    this->z = g * f;
+    this->t1 = e;
+    this->t2 = h;
     return *this;
 }
 
@@ -179,23 +223,23 @@ Extended &Extended::operator*=(const field::Fr &rhs) {
 }
 
 void Extended::set_x(const Scalar &scalar) {
-    this->x = scalar;
+    this->x = Fq{scalar};
 }
 
 void Extended::set_y(const Scalar &scalar) {
-    this->y = scalar;
+    this->y = Fq{scalar};
 }
 
 void Extended::set_z(const Scalar &scalar) {
-    this->z = scalar;
+    this->z = Fq{scalar};
 }
 
 void Extended::set_t1(const Scalar &scalar) {
-    this->t1 = scalar;
+    this->t1 = Fq{scalar};
 }
 
 void Extended::set_t2(const Scalar &scalar) {
-    this->t2 = scalar;
+    this->t2 = Fq{scalar};
 }
 
 } // namespace jubjub::group
\ No newline at end of file
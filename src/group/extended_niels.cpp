@@ -4,16 +4,16 @@
 
 #include "group/extended.h"
 #include "group/constants.h"
+#include "group/window.h"
 
 namespace jubjub::group {
 
 using bls12_381::scalar::Scalar;
 
+using field::Fq;
 using field::Fr;
-using constant::EDWARDS_D2;
 
-ExtendedNiels::ExtendedNiels()
-        : y_plus_x{Scalar::one()}, y_minus_x{Scalar::one()}, z{Scalar::one()}, t2d{Scalar::zero()} {}
+ExtendedNiels::ExtendedNiels() : y_plus_x{Fq::one()}, y_minus_x{Fq::one()}, z{Fq::one()}, t2d{Fq::zero()} {}
 
 ExtendedNiels ExtendedNiels::identity() noexcept {
     return ExtendedNiels{};
@@ -24,44 +24,49 @@ ExtendedNiels::ExtendedNiels(const ExtendedNiels &extended) = default;
 ExtendedNiels::ExtendedNiels(ExtendedNiels &&extended) noexcept = default;
 
 ExtendedNiels::ExtendedNiels(const Extended &extended)
-        : y_plus_x{extended.get_y() + extended.get_x()}, y_minus_x{extended.get_y() - extended.get_x()},
-          z{extended.get_z()}, t2d{extended.get_t1() * extended.get_t2() * EDWARDS_D2} {}
+        : y_plus_x{extended.y + extended.x}, y_minus_x{extended.y - extended.x},
+          z{extended.z}, t2d{constant::fq::EDWARDS_D2 * extended.t1.mul_lazy(extended.t2)} {}
+
+ExtendedNiels::ExtendedNiels(Fq y_plus_x, Fq y_minus_x, Fq z, Fq t2d)
+        : y_plus_x{std::move(y_plus_x)}, y_minus_x{std::move(y_minus_x)}, z{std::move(z)}, t2d{std::move(t2d)} {}
+
+ExtendedNiels ExtendedNiels::conditional_select(const ExtendedNiels &a, const ExtendedNiels &b, bool choice) {
+    return ExtendedNiels{
+            Fq::conditional_select(a.y_plus_x, b.y_plus_x, choice),
+            Fq::conditional_select(a.y_minus_x, b.y_minus_x, choice),
+            Fq::conditional_select(a.z, b.z, choice),
+            Fq::conditional_select(a.t2d, b.t2d, choice),
+    };
+}
 
 Extended ExtendedNiels::multiply(const std::array<uint8_t, 32> &by) const {
-    const ExtendedNiels zero = ExtendedNiels::identity();
-    Extended acc = Extended::identity();
-
-    for (auto iter = by.rbegin(); iter != by.rend(); iter++) {
-        for (int i = 7; i >= 0; --i) {
-            if (iter == by.rbegin() && i > 3) continue;
-            bool bit = (*iter >> i) & 1;
-            acc = acc.doubles();
-            if (bit) {
-                acc += *this;
-            } else {
-                acc += zero;
-            }
-        }
-    }
-    return acc;
+    return window::multiply(Extended::identity() + *this, by);
 }
 
 bls12_381::scalar::Scalar ExtendedNiels::get_y_plus_x() const {
-    return this->y_plus_x;
+    return this->y_plus_x.to_scalar();
 }
 
 bls12_381::scalar::Scalar ExtendedNiels::get_y_minus_x() const {
-    return this->y_minus_x;
+    return this->y_minus_x.to_scalar();
 }
 
 bls12_381::scalar::Scalar ExtendedNiels::get_z() const {
-    return this->z;
+    return this->z.to_scalar();
 }
 
 bls12_381::scalar::Scalar ExtendedNiels::get_t2d() const {
-    return this->t2d;
+    return this->t2d.to_scalar();
+}
+
+ExtendedNiels ExtendedNiels::operator-() const {
+    return ExtendedNiels{this->y_minus_x, this->y_plus_x, this->z, -this->t2d};
 }
 
+ExtendedNiels &ExtendedNiels::operator=(const ExtendedNiels &rhs) = default;
+
+ExtendedNiels &ExtendedNiels::operator=(ExtendedNiels &&rhs) noexcept = default;
+
 Extended operator+(const ExtendedNiels &lhs, const Extended &rhs) {
     return Extended{rhs} += lhs;
 }
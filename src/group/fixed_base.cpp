@@ -0,0 +1,67 @@
+#include "group/fixed_base.h"
+
+#include "field/fr.h"
+
+#include "group/affine.h"
+#include "group/constants.h"
+#include "group/extended_niels.h"
+#include "group/normalize.h"
+
+namespace jubjub::group {
+
+FixedBaseTable::FixedBaseTable(const Extended &base) {
+    // all multiples are computed projectively, then normalized with a single inversion
+    std::vector<Extended> multiples;
+    multiples.reserve(FixedBaseTable::WINDOWS * window::TABLE_SIZE);
+
+    Extended power = base;
+    for (size_t i = 0; i < FixedBaseTable::WINDOWS; ++i) {
+        const ExtendedNiels niels{power};
+        Extended multiple = power;
+        multiples.push_back(multiple);
+        for (size_t j = 1; j < window::TABLE_SIZE; ++j) {
+            multiple += niels;
+            multiples.push_back(multiple);
+        }
+        power = multiple.doubles();
+    }
+
+    const std::vector<Affine> affine = batch_normalize(multiples);
+
+    this->tables.resize(FixedBaseTable::WINDOWS);
+    for (size_t i = 0; i < FixedBaseTable::WINDOWS; ++i)
+        for (size_t j = 0; j < window::TABLE_SIZE; ++j)
+            this->tables[i][j] = AffineNiels{affine[i * window::TABLE_SIZE + j]};
+}
+
+const FixedBaseTable &FixedBaseTable::generator() {
+    static const FixedBaseTable table{constant::GENERATOR_EXTENDED};
+    return table;
+}
+
+const FixedBaseTable &FixedBaseTable::generator_nums() {
+    static const FixedBaseTable table{constant::GENERATOR_NUMS_EXTENDED};
+    return table;
+}
+
+const FixedBaseTable *FixedBaseTable::find(const Extended &base) {
+    if (base == constant::GENERATOR_EXTENDED) return &FixedBaseTable::generator();
+    if (base == constant::GENERATOR_NUMS_EXTENDED) return &FixedBaseTable::generator_nums();
+    return nullptr;
+}
+
+Extended FixedBaseTable::multiply(const std::array<uint8_t, 32> &by) const {
+    std::array<int8_t, field::recode::MAX_DIGITS> digits{};
+    field::recode::radix_2w(window::load_scalar(by), window::WIDTH, digits);
+
+    Extended acc = Extended::identity();
+    for (size_t i = 0; i < FixedBaseTable::WINDOWS; ++i)
+        acc += window::select(this->tables[i], digits[i]);
+    return acc;
+}
+
+Extended FixedBaseTable::multiply(const field::Fr &by) const {
+    return this->multiply(by.to_bytes());
+}
+
+} // namespace jubjub::group
\ No newline at end of file
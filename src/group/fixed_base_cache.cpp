@@ -0,0 +1,275 @@
+#include "group/fixed_base_cache.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "field/fr.h"
+
+#include "group/affine.h"
+
+#include "random/chacha20_rng.h"
+
+namespace jubjub::group {
+
+namespace {
+
+/// A slot announcing the snapshot one thread is reading, so that writers do not free it underneath.
+///
+/// Slots are shared by every cache, linked into a list that only grows, and claimed by one thread at a time.
+struct HazardSlot {
+    std::atomic<const void *> pointer{nullptr};
+    std::atomic<bool> active{false};
+    HazardSlot *next{nullptr};
+};
+
+static_assert(std::atomic<const void *>::is_always_lock_free, "readers rely on lock-free pointer atomics");
+
+std::atomic<HazardSlot *> hazard_slots{nullptr};
+
+HazardSlot &claim_slot() {
+    for (HazardSlot *slot = hazard_slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+        bool expected = false;
+        if (slot->active.compare_exchange_strong(expected, true, std::memory_order_acquire)) return *slot;
+    }
+
+    auto *slot = new HazardSlot{};
+    slot->active.store(true, std::memory_order_relaxed);
+    slot->next = hazard_slots.load(std::memory_order_relaxed);
+    while (!hazard_slots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed));
+    return *slot;
+}
+
+/// The slot of the calling thread, handed back to other threads when it exits.
+HazardSlot &local_slot() {
+    struct Owner {
+        HazardSlot &slot = claim_slot();
+
+        ~Owner() {
+            this->slot.pointer.store(nullptr, std::memory_order_release);
+            this->slot.active.store(false, std::memory_order_release);
+        }
+    };
+    thread_local Owner owner;
+    return owner.slot;
+}
+
+/// Keeps the snapshot read from `source` alive until destroyed.
+template<typename T>
+class Guard {
+private:
+    HazardSlot &slot;
+    const T *snapshot;
+
+public:
+    explicit Guard(const std::atomic<const T *> &source) : slot{local_slot()} {
+        // the snapshot is safe once it is still current after being announced
+        const T *current = source.load(std::memory_order_acquire);
+        do {
+            this->snapshot = current;
+            this->slot.pointer.store(current, std::memory_order_seq_cst);
+            current = source.load(std::memory_order_seq_cst);
+        } while (current != this->snapshot);
+    }
+
+    ~Guard() { this->slot.pointer.store(nullptr, std::memory_order_release); }
+
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+
+    const T &operator*() const { return *this->snapshot; }
+};
+
+inline void sip_round(uint64_t &v0, uint64_t &v1, uint64_t &v2, uint64_t &v3) {
+    v0 += v1;
+    v1 = std::rotl(v1, 13) ^ v0;
+    v0 = std::rotl(v0, 32);
+    v2 += v3;
+    v3 = std::rotl(v3, 16) ^ v2;
+    v0 += v3;
+    v3 = std::rotl(v3, 21) ^ v0;
+    v2 += v1;
+    v1 = std::rotl(v1, 17) ^ v2;
+    v2 = std::rotl(v2, 32);
+}
+
+} // namespace
+
+size_t FixedBaseCache::KeyHash::operator()(const Key &key) const noexcept {
+    uint64_t v0 = this->k0 ^ 0x736f6d6570736575;
+    uint64_t v1 = this->k1 ^ 0x646f72616e646f6d;
+    uint64_t v2 = this->k0 ^ 0x6c7967656e657261;
+    uint64_t v3 = this->k1 ^ 0x7465646279746573;
+
+    for (size_t i = 0; i < key.size(); i += sizeof(uint64_t)) {
+        uint64_t m;
+        std::memcpy(&m, key.data() + i, sizeof(m));
+        v3 ^= m;
+        sip_round(v0, v1, v2, v3);
+        v0 ^= m;
+    }
+
+    const uint64_t last = static_cast<uint64_t>(key.size()) << 56;
+    v3 ^= last;
+    sip_round(v0, v1, v2, v3);
+    v0 ^= last;
+
+    v2 ^= 0xff;
+    for (int i = 0; i < 3; ++i)
+        sip_round(v0, v1, v2, v3);
+    return static_cast<size_t>(v0 ^ v1 ^ v2 ^ v3);
+}
+
+FixedBaseCache::FixedBaseCache(size_t max_bytes, uint32_t admission)
+        : hasher{[]() {
+            random::ChaCha20Rng rng{};
+            return KeyHash{rng.next_u64(), rng.next_u64()};
+        }()},
+          index{new Index{0, this->hasher}}, epoch{0}, misses{0, this->hasher}, max_bytes{max_bytes},
+          admission{admission} {}
+
+FixedBaseCache::~FixedBaseCache() {
+    // no reader may outlive the cache, so every snapshot can go
+    for (const Index *snapshot: this->retired)
+        delete snapshot;
+    delete this->index.load(std::memory_order_acquire);
+}
+
+FixedBaseCache &FixedBaseCache::global() {
+    static FixedBaseCache cache{};
+    return cache;
+}
+
+const FixedBaseCache::Entry *FixedBaseCache::find(const Index &snapshot, const Key &key) const {
+    const auto iter = snapshot.find(key);
+    if (iter == snapshot.end()) return nullptr;
+
+    // hot entries are written once per insertion, not once per hit
+    const Entry &entry = *iter->second;
+    const uint64_t now = this->epoch.load(std::memory_order_relaxed);
+    if (entry.last_used.load(std::memory_order_relaxed) != now)
+        entry.last_used.store(now, std::memory_order_relaxed);
+    return &entry;
+}
+
+std::shared_ptr<const FixedBaseTable> FixedBaseCache::get(const Extended &base) {
+    return this->get(Affine{base}.to_bytes(), base);
+}
+
+std::shared_ptr<const FixedBaseTable> FixedBaseCache::get(const Key &key, const Extended &base) {
+    {
+        const Guard<Index> snapshot{this->index};
+        if (const Entry *entry = this->find(*snapshot, key)) return entry->table;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock{this->writer};
+        if (this->capacity() == 0) return nullptr;
+
+        // another writer may have inserted the table since the snapshot was taken
+        const Index &snapshot = *this->index.load(std::memory_order_acquire);
+        const auto iter = snapshot.find(key);
+        if (iter != snapshot.end()) return iter->second->table;
+
+        if (++this->misses[key] < this->admission) {
+            // the doorkeeper only needs to remember recent misses
+            if (this->misses.size() > 4 * this->capacity()) this->misses.clear();
+            return nullptr;
+        }
+        this->misses.erase(key);
+    }
+
+    // the table is built outside the lock, so concurrent misses on other points are not held up
+    auto table = std::make_shared<const FixedBaseTable>(base);
+
+    const std::lock_guard<std::mutex> lock{this->writer};
+    const Index &snapshot = *this->index.load(std::memory_order_acquire);
+    const auto iter = snapshot.find(key);
+    if (iter != snapshot.end()) return iter->second->table;
+
+    // uses since the previous insertion share its timestamp, and later ones get a newer one
+    const uint64_t now = this->epoch.load(std::memory_order_relaxed);
+    auto entry = std::make_shared<Entry>();
+    entry->table = table;
+    entry->last_used.store(now, std::memory_order_relaxed);
+    this->epoch.store(now + 1, std::memory_order_relaxed);
+
+    auto *next = new Index{snapshot};
+    next->emplace(key, std::move(entry));
+    this->evict(*next);
+    this->publish(next);
+    return table;
+}
+
+Extended FixedBaseCache::multiply(const Extended &base, const field::Fr &by) {
+    const Key key = Affine{base}.to_bytes();
+    {
+        // the snapshot keeps the table alive, so a hit does not touch its reference count
+        const Guard<Index> snapshot{this->index};
+        if (const Entry *entry = this->find(*snapshot, key)) return entry->table->multiply(by);
+    }
+
+    const std::shared_ptr<const FixedBaseTable> table = this->get(key, base);
+    return table != nullptr ? table->multiply(by) : base * by;
+}
+
+void FixedBaseCache::set_max_bytes(size_t bytes) {
+    const std::lock_guard<std::mutex> lock{this->writer};
+    this->max_bytes = bytes;
+
+    const Index &snapshot = *this->index.load(std::memory_order_acquire);
+    if (snapshot.size() <= this->capacity()) return;
+
+    auto *next = new Index{snapshot};
+    this->evict(*next);
+    this->publish(next);
+}
+
+size_t FixedBaseCache::get_max_bytes() const {
+    const std::lock_guard<std::mutex> lock{this->writer};
+    return this->max_bytes;
+}
+
+size_t FixedBaseCache::size() const {
+    const Guard<Index> snapshot{this->index};
+    return (*snapshot).size();
+}
+
+void FixedBaseCache::clear() {
+    const std::lock_guard<std::mutex> lock{this->writer};
+    this->misses.clear();
+    this->publish(new Index{0, this->hasher});
+}
+
+void FixedBaseCache::evict(Index &index) const {
+    const size_t capacity = this->capacity();
+    if (index.size() <= capacity) return;
+
+    // timestamps only grow, so the oldest ones are found by a partial sort of a copy taken now
+    std::vector<std::pair<uint64_t, Key>> stamps;
+    stamps.reserve(index.size());
+    for (const auto &[key, entry]: index)
+        stamps.emplace_back(entry->last_used.load(std::memory_order_relaxed), key);
+
+    const size_t excess = index.size() - capacity;
+    std::nth_element(stamps.begin(), stamps.begin() + static_cast<std::ptrdiff_t>(excess - 1), stamps.end());
+    for (size_t i = 0; i < excess; ++i)
+        index.erase(stamps[i].second);
+}
+
+void FixedBaseCache::publish(const Index *next) {
+    this->retired.push_back(this->index.exchange(next, std::memory_order_seq_cst));
+
+    std::vector<const void *> guarded;
+    for (HazardSlot *slot = hazard_slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+        guarded.push_back(slot->pointer.load(std::memory_order_seq_cst));
+
+    // a reader announcing a retired snapshot re-checks the current one, so it never starts using it afresh
+    std::erase_if(this->retired, [&](const Index *snapshot) {
+        if (std::find(guarded.begin(), guarded.end(), snapshot) != guarded.end()) return false;
+        delete snapshot;
+        return true;
+    });
+}
+
+} // namespace jubjub::group
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "group/msm.h"
+
+#include <algorithm>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+#include "field/fr.h"
+#include "field/recode.h"
+
+#include "group/affine_niels.h"
+#include "group/extended_niels.h"
+#include "group/window.h"
+#include "group/wnaf.h"
+
+namespace jubjub::group {
+
+namespace {
+
+constexpr size_t SCALAR_BITS = 252;
+constexpr uint8_t MAX_WINDOW = 15;
+constexpr size_t MIN_POINTS_PER_THREAD = 1024;
+
+using Limbs = std::array<uint64_t, 4>;
+
+size_t window_count(uint8_t window) {
+    // one window more than the bits need absorbs the carry out of the signed recoding
+    return SCALAR_BITS / window + 1;
+}
+
+size_t straus_cost(size_t n) {
+    return SCALAR_BITS + n * (SCALAR_BITS / (wnaf::WIDTH + 1) + wnaf::TABLE_SIZE);
+}
+
+size_t pippenger_cost(size_t n, uint8_t window) {
+    // every window adds each point to a bucket, and sums the buckets with two additions each
+    const size_t buckets = size_t{1} << (window - 1);
+    return SCALAR_BITS + window_count(window) * (n + 2 * buckets);
+}
+
+uint8_t pippenger_window(size_t n) {
+    uint8_t best = 2;
+    for (uint8_t window = 3; window <= MAX_WINDOW; ++window)
+        if (pippenger_cost(n, window) < pippenger_cost(n, best)) best = window;
+    return best;
+}
+
+std::vector<Limbs> load_scalars(std::span<const field::Fr> scalars) {
+    std::vector<Limbs> limbs;
+    limbs.reserve(scalars.size());
+    for (const field::Fr &scalar: scalars)
+        limbs.push_back(window::load_scalar(scalar.to_bytes()));
+    return limbs;
+}
+
+/// Writes the signed radix-`2^window` digits of every scalar, window-major, with digits in
+/// `[-2^(window-1), 2^(window-1)]`.
+std::vector<int16_t> recode_signed(const std::vector<Limbs> &scalars, uint8_t window) {
+    const size_t windows = window_count(window);
+    const uint64_t mask = (uint64_t{1} << window) - 1;
+    const auto half = static_cast<int64_t>(uint64_t{1} << (window - 1));
+
+    std::vector<int16_t> digits(windows * scalars.size());
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        const Limbs &s = scalars[i];
+        int64_t carry = 0;
+        for (size_t k = 0; k < windows; ++k) {
+            const size_t pos = k * window, limb = pos / 64, shift = pos % 64;
+            uint64_t bits = limb < 4 ? s[limb] >> shift : 0;
+            if (shift + window > 64 && limb + 1 < 4) bits |= s[limb + 1] << (64 - shift);
+
+            int64_t digit = static_cast<int64_t>(bits & mask) + carry;
+            carry = digit > half ? 1 : 0;
+            digit -= carry << window;
+            digits[k * scalars.size() + i] = static_cast<int16_t>(digit);
+        }
+        assert(carry == 0);
+    }
+    return digits;
+}
+
+Extended straus(std::span<const Extended> points, const std::vector<Limbs> &scalars) {
+    std::vector<wnaf::OddMultiples> tables;
+    std::vector<std::array<int8_t, field::recode::MAX_DIGITS>> digits(points.size());
+    tables.reserve(points.size());
+
+    size_t length = 0;
+    for (size_t i = 0; i < points.size(); ++i) {
+        tables.emplace_back(points[i]);
+        length = std::max(length, field::recode::wnaf(scalars[i], wnaf::WIDTH, digits[i]));
+    }
+
+    // doublings are deferred across digits where every NAF is zero, to run them as one projective chain
+    Extended acc = Extended::identity();
+    uint32_t pending = 0;
+    for (size_t k = length; k-- > 0;) {
+        pending += 1;
+        bool any = false;
+        for (size_t i = 0; i < points.size(); ++i)
+            any |= digits[i][k] != 0;
+        if (!any) continue;
+
+        acc = acc.double_n(pending);
+        pending = 0;
+        for (size_t i = 0; i < points.size(); ++i)
+            tables[i].accumulate(acc, digits[i][k]);
+    }
+    return acc.double_n(pending);
+}
+
+/// Sums the points of window `k` into buckets and folds them into `sum(j * bucket[j])`.
+template<typename Niels>
+Extended pippenger_window_sum(std::span<const Niels> points, const std::vector<int16_t> &digits, size_t k,
+                              std::vector<Extended> &buckets) {
+    std::fill(buckets.begin(), buckets.end(), Extended::identity());
+
+    const int16_t *row = digits.data() + k * points.size();
+    for (size_t i = 0; i < points.size(); ++i) {
+        const int16_t digit = row[i];
+        if (digit > 0)
+            buckets[digit - 1] += points[i];
+        else if (digit < 0)
+            buckets[-digit - 1] -= points[i];
+    }
+
+    // running sums from the top bucket down weight every bucket by its index
+    Extended running = Extended::identity();
+    Extended sum = Extended::identity();
+    for (size_t j = buckets.size(); j-- > 0;) {
+        running += buckets[j];
+        sum += running;
+    }
+    return sum;
+}
+
+template<typename Niels>
+Extended pippenger(std::span<const Niels> points, const std::vector<Limbs> &scalars, uint32_t threads) {
+    const uint8_t window = pippenger_window(points.size());
+    const size_t windows = window_count(window);
+    const std::vector<int16_t> digits = recode_signed(scalars, window);
+
+    const size_t max_threads = std::max<size_t>(points.size() / MIN_POINTS_PER_THREAD, 1);
+    const size_t num_threads = std::clamp<size_t>(threads, 1, std::min(max_threads, windows));
+
+    std::vector<Extended> sums(windows);
+    const auto work = [&](size_t first) {
+        std::vector<Extended> buckets(size_t{1} << (window - 1));
+        for (size_t k = first; k < windows; k += num_threads)
+            sums[k] = pippenger_window_sum(points, digits, k, buckets);
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads - 1);
+    for (size_t t = 1; t < num_threads; ++t)
+        workers.emplace_back(work, t);
+    work(0);
+    for (std::thread &worker: workers) worker.join();
+
+    Extended acc = sums[windows - 1];
+    for (size_t k = windows - 1; k-- > 0;) {
+        acc = acc.double_n(window);
+        acc += sums[k];
+    }
+    return acc;
+}
+
+template<typename Point, typename Niels>
+Extended msm(std::span<const Point> points, std::span<const field::Fr> scalars, uint32_t threads) {
+    assert(points.size() == scalars.size());
+    if (points.empty()) return Extended::identity();
+
+    const std::vector<Limbs> limbs = load_scalars(scalars);
+
+    if (straus_cost(points.size()) <= pippenger_cost(points.size(), pippenger_window(points.size()))) {
+        std::vector<Extended> extended;
+        extended.reserve(points.size());
+        for (const Point &point: points)
+            extended.emplace_back(point);
+        return straus(extended, limbs);
+    }
+
+    std::vector<Niels> niels;
+    niels.reserve(points.size());
+    for (const Point &point: points)
+        niels.emplace_back(point);
+    return pippenger<Niels>(std::span<const Niels>{niels}, limbs, threads);
+}
+
+} // namespace
+
+Extended msm(std::span<const Extended> points, std::span<const field::Fr> scalars) {
+    return msm<Extended, ExtendedNiels>(points, scalars, 1);
+}
+
+Extended msm(std::span<const Extended> points, std::span<const field::Fr> scalars, uint32_t threads) {
+    return msm<Extended, ExtendedNiels>(points, scalars, threads);
+}
+
+Extended msm(std::span<const Affine> points, std::span<const field::Fr> scalars) {
+    return msm<Affine, AffineNiels>(points, scalars, 1);
+}
+
+Extended msm(std::span<const Affine> points, std::span<const field::Fr> scalars, uint32_t threads) {
+    return msm<Affine, AffineNiels>(points, scalars, threads);
+}
+
+} // namespace jubjub::group
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "group/multiply_many.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "field/fr.h"
+#include "field/recode.h"
+
+#include "group/affine.h"
+#include "group/affine_niels.h"
+#include "group/completed.h"
+#include "group/extended_niels.h"
+#include "group/normalize.h"
+#include "group/projective.h"
+#include "group/window.h"
+
+namespace jubjub::group {
+
+namespace {
+
+using Digits = std::array<int8_t, field::recode::MAX_DIGITS>;
+
+template<typename Niels>
+using Table = std::array<Niels, window::TABLE_SIZE>;
+
+/// Returns the multiples `[P, 2P, ..., TABLE_SIZE * P]` of every point, point-major.
+std::vector<Extended> multiples_of(std::span<const Extended> points) {
+    std::vector<Extended> multiples;
+    multiples.reserve(points.size() * window::TABLE_SIZE);
+    for (const Extended &point: points) {
+        const ExtendedNiels niels{point};
+        Extended multiple = point;
+        multiples.push_back(multiple);
+        for (size_t j = 1; j < window::TABLE_SIZE; ++j) {
+            multiple += niels;
+            multiples.push_back(multiple);
+        }
+    }
+    return multiples;
+}
+
+template<typename Niels, typename Point>
+std::vector<Table<Niels>> tables_of(const std::vector<Point> &multiples) {
+    std::vector<Table<Niels>> tables(multiples.size() / window::TABLE_SIZE);
+    for (size_t i = 0; i < tables.size(); ++i)
+        for (size_t j = 0; j < window::TABLE_SIZE; ++j)
+            tables[i][j] = Niels{multiples[i * window::TABLE_SIZE + j]};
+    return tables;
+}
+
+template<typename Niels>
+void run_chains(const std::vector<Table<Niels>> &tables, const Digits &digits, size_t length,
+                std::span<Extended> points) {
+    for (size_t start = 0; start < points.size(); start += MULTIPLY_MANY_LANES) {
+        const size_t lanes = std::min(MULTIPLY_MANY_LANES, points.size() - start);
+        const Table<Niels> *lane_tables = tables.data() + start;
+
+        // the lanes are independent, so stepping them together lets their field operations overlap
+        std::array<Extended, MULTIPLY_MANY_LANES> acc;
+        for (size_t l = 0; l < lanes; ++l)
+            acc[l] = Extended::identity() + window::select(lane_tables[l], digits[length - 1]);
+
+        for (size_t i = length - 1; i-- > 0;) {
+            // as in `Extended::double_n`, only the last doubling of each window completes into extended form
+            std::array<Projective, MULTIPLY_MANY_LANES> runs;
+            for (size_t l = 0; l < lanes; ++l)
+                runs[l] = Projective{acc[l]};
+            for (uint8_t j = 1; j < window::WIDTH; ++j)
+                for (size_t l = 0; l < lanes; ++l)
+                    runs[l] = runs[l].doubles();
+            for (size_t l = 0; l < lanes; ++l)
+                acc[l] = Extended{runs[l].double_completed()};
+            for (size_t l = 0; l < lanes; ++l)
+                acc[l] += window::select(lane_tables[l], digits[i]);
+        }
+
+        for (size_t l = 0; l < lanes; ++l)
+            points[start + l] = acc[l];
+    }
+}
+
+} // namespace
+
+void multiply_many(const field::Fr &by, std::span<Extended> points) {
+    if (points.empty()) return;
+
+    Digits digits{};
+    const size_t length = field::recode::radix_2w(window::load_scalar(by.to_bytes()), window::WIDTH, digits);
+    std::vector<Extended> multiples = multiples_of(points);
+
+    // the single inversion of the batch only pays for itself once it is shared by enough points
+    if (points.size() < MULTIPLY_MANY_MIN_NORMALIZE)
+        return run_chains(tables_of<ExtendedNiels>(multiples), digits, length, points);
+    run_chains(tables_of<AffineNiels>(batch_normalize(multiples)), digits, length, points);
+}
+
+} // namespace jubjub::group
\ No newline at end of file
@@ -2,36 +2,34 @@
 
 namespace jubjub::group {
 
-using bls12_381::scalar::Scalar;
+using field::Fq;
 
 auto batch_normalize(std::vector<Extended> &y) -> std::vector<Affine> {
-    Scalar acc = Scalar::one();
+    Fq acc = Fq::one();
     for (Extended &p: y) {
-        p.set_t1(acc);
-        acc *= p.get_z();
+        p.t1 = acc;
+        acc *= p.z;
     }
 
     acc = acc.invert().value();
 
     for (auto iter = y.rbegin(); iter != y.rend(); iter++) { // NOLINT(modernize-loop-convert)
-        Extended q = *iter;
-        const Scalar temp = q.get_t1() * acc;
+        Extended &q = *iter;
+        const Fq temp = q.t1 * acc;
 
-        acc *= q.get_z();
+        acc *= q.z;
 
-        q.set_x(q.get_x() * temp);
-        q.set_y(q.get_y() * temp);
-        q.set_z(Scalar::one());
-        q.set_t1(q.get_x());
-        q.set_t2(q.get_y());
-
-        *iter = q;
+        q.x *= temp;
+        q.y *= temp;
+        q.z = Fq::one();
+        q.t1 = q.x;
+        q.t2 = q.y;
     }
 
     std::vector<Affine> res;
     res.reserve(y.size());
     for (const Extended &point: y)
-        res.emplace_back(point.get_x(), point.get_y());
+        res.push_back(Affine{point.x, point.y});
 
     return res;
 }
@@ -0,0 +1,50 @@
+#include "group/projective.h"
+
+#include "group/completed.h"
+#include "group/extended.h"
+
+namespace jubjub::group {
+
+using field::Fq;
+
+Projective::Projective() : x{Fq::zero()}, y{Fq::one()}, z{Fq::one()} {}
+
+Projective::Projective(const Projective &projective) = default;
+
+Projective::Projective(Projective &&projective) noexcept = default;
+
+Projective::Projective(const Extended &extended) : x{extended.x}, y{extended.y}, z{extended.z} {}
+
+Projective::Projective(const Completed &completed)
+        : x{completed.x * completed.t}, y{completed.y * completed.z}, z{completed.z * completed.t} {}
+
+Projective Projective::identity() noexcept {
+    return Projective{};
+}
+
+bool Projective::is_identity() const {
+    return this->x.is_zero() && (this->y == this->z);
+}
+
+Projective Projective::doubles() const {
+    return Projective{this->double_completed()};
+}
+
+Completed Projective::double_completed() const {
+    const Fq xx = this->x.square();
+    const Fq yy = this->y.square();
+    const Fq zz2 = this->z.square().doubles();
+    const Fq xy2 = (this->x + this->y).square();
+
+    const Fq e = xy2 - (yy + xx);
+    const Fq g = yy - xx;
+    const Fq h = yy + xx;
+    // t is redundant, which both conversions allow as it is only ever a right operand
+    return Completed{e, h, g, zz2.sub_lazy(g)};
+}
+
+Projective &Projective::operator=(const Projective &rhs) = default;
+
+Projective &Projective::operator=(Projective &&rhs) noexcept = default;
+
+} // namespace jubjub::group
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "group/window.h"
+
+#include "field/recode.h"
+
+namespace jubjub::group::window {
+
+std::array<uint64_t, 4> load_scalar(const std::array<uint8_t, 32> &by) {
+    std::array<uint64_t, 4> limbs{};
+    for (size_t i = 0; i < by.size(); ++i)
+        limbs[i / 8] |= static_cast<uint64_t>(by[i]) << (8 * (i % 8));
+    limbs[3] &= UINT64_MAX >> 4;
+    return limbs;
+}
+
+LookupTable::LookupTable(const Extended &point) {
+    this->entries[0] = ExtendedNiels{point};
+    Extended multiple = point;
+    for (size_t i = 1; i < TABLE_SIZE; ++i) {
+        multiple += this->entries[0];
+        this->entries[i] = ExtendedNiels{multiple};
+    }
+}
+
+ExtendedNiels LookupTable::select(int8_t digit) const {
+    return window::select(this->entries, digit);
+}
+
+Extended multiply(const Extended &point, const std::array<uint8_t, 32> &by) {
+    std::array<int8_t, field::recode::MAX_DIGITS> digits{};
+    const size_t length = field::recode::radix_2w(load_scalar(by), WIDTH, digits);
+    const LookupTable table{point};
+
+    // the top digit seeds the accumulator, so no doublings are spent on the identity
+    Extended acc = Extended::identity() + table.select(digits[length - 1]);
+    for (size_t i = length - 1; i-- > 0;) {
+        acc = acc.double_n(WIDTH);
+        acc += table.select(digits[i]);
+    }
+    return acc;
+}
+
+Extended double_multiply(const std::array<uint8_t, 32> &a, const Extended &p, const std::array<uint8_t, 32> &b,
+                         const Extended &q) {
+    std::array<int8_t, field::recode::MAX_DIGITS> digits_a{};
+    std::array<int8_t, field::recode::MAX_DIGITS> digits_b{};
+    const size_t length = field::recode::radix_2w(load_scalar(a), WIDTH, digits_a);
+    field::recode::radix_2w(load_scalar(b), WIDTH, digits_b);
+    const LookupTable table_p{p};
+    const LookupTable table_q{q};
+
+    Extended acc = Extended::identity() + table_p.select(digits_a[length - 1]);
+    acc += table_q.select(digits_b[length - 1]);
+    for (size_t i = length - 1; i-- > 0;) {
+        acc = acc.double_n(WIDTH);
+        acc += table_p.select(digits_a[i]);
+        acc += table_q.select(digits_b[i]);
+    }
+    return acc;
+}
+
+} // namespace jubjub::group::window
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "group/wnaf.h"
+
+#include <algorithm>
+
+#include "field/recode.h"
+
+namespace jubjub::group::wnaf {
+
+OddMultiples::OddMultiples(const Extended &point) {
+    const ExtendedNiels twice{point.doubles()};
+    this->entries[0] = ExtendedNiels{point};
+    Extended multiple = point;
+    for (size_t i = 1; i < TABLE_SIZE; ++i) {
+        multiple += twice;
+        this->entries[i] = ExtendedNiels{multiple};
+    }
+}
+
+void OddMultiples::accumulate(Extended &acc, int8_t digit) const {
+    if (digit > 0)
+        acc += this->get(digit);
+    else if (digit < 0)
+        acc -= this->get(static_cast<int8_t>(-digit));
+}
+
+Extended multiply(const Extended &point, const std::array<uint64_t, 4> &limbs) {
+    std::array<int8_t, field::recode::MAX_DIGITS> digits{};
+    const size_t length = field::recode::wnaf(limbs, WIDTH, digits);
+    if (length == 0) return Extended::identity();
+
+    const OddMultiples table{point};
+
+    // the top digit is non-zero and seeds the accumulator, and the doublings over runs of zero digits are deferred
+    // to run as one projective chain
+    Extended acc = Extended::identity();
+    table.accumulate(acc, digits[length - 1]);
+    uint32_t pending = 0;
+    for (size_t i = length - 1; i-- > 0;) {
+        pending += 1;
+        if (digits[i] == 0) continue;
+
+        acc = acc.double_n(pending);
+        pending = 0;
+        table.accumulate(acc, digits[i]);
+    }
+    return acc.double_n(pending);
+}
+
+Extended double_multiply(const std::array<uint64_t, 4> &a, const Extended &p, const std::array<uint64_t, 4> &b,
+                         const Extended &q) {
+    std::array<int8_t, field::recode::MAX_DIGITS> digits_a{};
+    std::array<int8_t, field::recode::MAX_DIGITS> digits_b{};
+    const size_t length = std::max(field::recode::wnaf(a, WIDTH, digits_a), field::recode::wnaf(b, WIDTH, digits_b));
+    if (length == 0) return Extended::identity();
+
+    const OddMultiples table_p{p};
+    const OddMultiples table_q{q};
+
+    Extended acc = Extended::identity();
+    table_p.accumulate(acc, digits_a[length - 1]);
+    table_q.accumulate(acc, digits_b[length - 1]);
+    uint32_t pending = 0;
+    for (size_t i = length - 1; i-- > 0;) {
+        pending += 1;
+        if (digits_a[i] == 0 && digits_b[i] == 0) continue;
+
+        acc = acc.double_n(pending);
+        pending = 0;
+        table_p.accumulate(acc, digits_a[i]);
+        table_q.accumulate(acc, digits_b[i]);
+    }
+    return acc.double_n(pending);
+}
+
+} // namespace jubjub::group::wnaf
\ No newline at end of file
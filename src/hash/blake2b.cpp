@@ -0,0 +1,337 @@
+#include "hash/blake2b.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#ifdef JUBJUB_BLAKE2B_X86
+#include <immintrin.h>
+#endif
+
+namespace jubjub::hash {
+
+namespace {
+
+constexpr std::array<uint64_t, 8> IV = {
+        0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+        0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
+};
+
+constexpr uint8_t SIGMA[12][16] = {
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+        {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+        {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+        {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+        {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+        {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+        {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+        {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+        {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+};
+
+/// The column step of a round followed by the diagonal step, as `(a, b, c, d)` state indices.
+constexpr uint8_t MIX[8][4] = {
+        {0, 4, 8, 12}, {1, 5, 9, 13}, {2, 6, 10, 14}, {3, 7, 11, 15},
+        {0, 5, 10, 15}, {1, 6, 11, 12}, {2, 7, 8, 13}, {3, 4, 9, 14},
+};
+
+inline uint64_t load_le(const uint8_t *bytes) {
+    uint64_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    if constexpr (std::endian::native == std::endian::big) value = __builtin_bswap64(value);
+    return value;
+}
+
+inline void store_le(uint8_t *bytes, uint64_t value) {
+    if constexpr (std::endian::native == std::endian::big) value = __builtin_bswap64(value);
+    std::memcpy(bytes, &value, sizeof(value));
+}
+
+size_t block_count(size_t size) {
+    // the empty message still compresses one zero block
+    return size == 0 ? 1 : (size + Blake2b::BLOCK_SIZE - 1) / Blake2b::BLOCK_SIZE;
+}
+
+/// Reads block `index` of `message` as words, zero-padding a trailing partial block.
+void load_block(std::span<const uint8_t> message, size_t index, std::array<uint64_t, 16> &m) {
+    const size_t offset = index * Blake2b::BLOCK_SIZE;
+    if (offset + Blake2b::BLOCK_SIZE <= message.size()) {
+        for (int i = 0; i < 16; ++i)
+            m[i] = load_le(message.data() + offset + i * sizeof(uint64_t));
+        return;
+    }
+
+    std::array<uint8_t, Blake2b::BLOCK_SIZE> padded{};
+    if (offset < message.size())
+        std::copy(message.begin() + offset, message.end(), padded.begin());
+    for (int i = 0; i < 16; ++i)
+        m[i] = load_le(padded.data() + i * sizeof(uint64_t));
+}
+
+void compress(std::array<uint64_t, 8> &h, const std::array<uint64_t, 16> &m, uint64_t counter, bool last) {
+    std::array<uint64_t, 16> v{};
+    for (int i = 0; i < 8; ++i) {
+        v[i] = h[i];
+        v[i + 8] = IV[i];
+    }
+    v[12] ^= counter;
+    v[14] ^= -static_cast<uint64_t>(last);
+
+    for (const auto &s: SIGMA) {
+        for (int i = 0; i < 8; ++i) {
+            uint64_t &a = v[MIX[i][0]], &b = v[MIX[i][1]], &c = v[MIX[i][2]], &d = v[MIX[i][3]];
+            a += b + m[s[2 * i]];
+            d = std::rotr(d ^ a, 32);
+            c += d;
+            b = std::rotr(b ^ c, 24);
+            a += b + m[s[2 * i + 1]];
+            d = std::rotr(d ^ a, 16);
+            c += d;
+            b = std::rotr(b ^ c, 63);
+        }
+    }
+
+    for (int i = 0; i < 8; ++i)
+        h[i] ^= v[i] ^ v[i + 8];
+}
+
+Blake2b::Digest digest_of(const std::array<uint64_t, 8> &h) {
+    Blake2b::Digest out{};
+    for (int i = 0; i < 8; ++i)
+        store_le(out.data() + i * sizeof(uint64_t), h[i]);
+    return out;
+}
+
+void hash_one(const std::array<uint64_t, 8> &h0, std::span<const uint8_t> message, Blake2b::Digest &out) {
+    std::array<uint64_t, 8> h = h0;
+    std::array<uint64_t, 16> m{};
+    const size_t blocks = block_count(message.size());
+    for (size_t i = 0; i < blocks; ++i) {
+        load_block(message, i, m);
+        const bool last = i + 1 == blocks;
+        compress(h, m, last ? message.size() : (i + 1) * Blake2b::BLOCK_SIZE, last);
+    }
+    out = digest_of(h);
+}
+
+#ifdef JUBJUB_BLAKE2B_X86
+namespace avx2 {
+
+__attribute__((target("avx2"))) inline __m256i rotr32(__m256i x) {
+    return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+__attribute__((target("avx2"))) inline __m256i rotr24(__m256i x) {
+    const __m256i mask = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                          3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+    return _mm256_shuffle_epi8(x, mask);
+}
+
+__attribute__((target("avx2"))) inline __m256i rotr16(__m256i x) {
+    const __m256i mask = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                          2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+    return _mm256_shuffle_epi8(x, mask);
+}
+
+__attribute__((target("avx2"))) inline __m256i rotr63(__m256i x) {
+    return _mm256_or_si256(_mm256_srli_epi64(x, 63), _mm256_add_epi64(x, x));
+}
+
+/// Hashes up to `LANES` messages, lane `l` of every vector carrying the state of message `l`.
+__attribute__((target("avx2")))
+void hash_lanes(const std::array<uint64_t, 8> &h0, std::span<const std::span<const uint8_t>> messages,
+                std::span<Blake2b::Digest *> out) {
+    constexpr size_t LANES = Blake2b::LANES;
+
+    std::array<size_t, LANES> blocks{};
+    size_t rounds = 0;
+    for (size_t l = 0; l < messages.size(); ++l) {
+        blocks[l] = block_count(messages[l].size());
+        rounds = std::max(rounds, blocks[l]);
+    }
+
+    __m256i h[8];
+    for (int i = 0; i < 8; ++i)
+        h[i] = _mm256_set1_epi64x(static_cast<int64_t>(h0[i]));
+
+    alignas(32) uint64_t words[16][LANES];
+    alignas(32) uint64_t counters[LANES], finals[LANES], actives[LANES];
+    std::array<uint64_t, 16> m{};
+
+    for (size_t b = 0; b < rounds; ++b) {
+        for (size_t l = 0; l < LANES; ++l) {
+            const bool active = b < blocks[l];
+            const bool last = b + 1 == blocks[l];
+            if (active) load_block(messages[l], b, m);
+            else m.fill(0);
+
+            for (int i = 0; i < 16; ++i)
+                words[i][l] = m[i];
+            counters[l] = last ? messages[l].size() : (b + 1) * Blake2b::BLOCK_SIZE;
+            finals[l] = -static_cast<uint64_t>(last);
+            actives[l] = -static_cast<uint64_t>(active);
+        }
+
+        __m256i w[16];
+        for (int i = 0; i < 16; ++i)
+            w[i] = _mm256_load_si256(reinterpret_cast<const __m256i *>(words[i]));
+
+        __m256i v[16];
+        for (int i = 0; i < 8; ++i) {
+            v[i] = h[i];
+            v[i + 8] = _mm256_set1_epi64x(static_cast<int64_t>(IV[i]));
+        }
+        v[12] = _mm256_xor_si256(v[12], _mm256_load_si256(reinterpret_cast<const __m256i *>(counters)));
+        v[14] = _mm256_xor_si256(v[14], _mm256_load_si256(reinterpret_cast<const __m256i *>(finals)));
+
+        for (const auto &s: SIGMA) {
+            for (int i = 0; i < 8; ++i) {
+                __m256i &a = v[MIX[i][0]], &bb = v[MIX[i][1]], &c = v[MIX[i][2]], &d = v[MIX[i][3]];
+                a = _mm256_add_epi64(_mm256_add_epi64(a, bb), w[s[2 * i]]);
+                d = rotr32(_mm256_xor_si256(d, a));
+                c = _mm256_add_epi64(c, d);
+                bb = rotr24(_mm256_xor_si256(bb, c));
+                a = _mm256_add_epi64(_mm256_add_epi64(a, bb), w[s[2 * i + 1]]);
+                d = rotr16(_mm256_xor_si256(d, a));
+                c = _mm256_add_epi64(c, d);
+                bb = rotr63(_mm256_xor_si256(bb, c));
+            }
+        }
+
+        // lanes whose message is already finished keep their state
+        const __m256i active = _mm256_load_si256(reinterpret_cast<const __m256i *>(actives));
+        for (int i = 0; i < 8; ++i) {
+            const __m256i next = _mm256_xor_si256(h[i], _mm256_xor_si256(v[i], v[i + 8]));
+            h[i] = _mm256_blendv_epi8(h[i], next, active);
+        }
+    }
+
+    alignas(32) uint64_t state[8][LANES];
+    for (int i = 0; i < 8; ++i)
+        _mm256_store_si256(reinterpret_cast<__m256i *>(state[i]), h[i]);
+    for (size_t l = 0; l < messages.size(); ++l) {
+        std::array<uint64_t, 8> lane{};
+        for (int i = 0; i < 8; ++i)
+            lane[i] = state[i][l];
+        *out[l] = digest_of(lane);
+    }
+}
+
+} // namespace avx2
+#endif
+
+} // namespace
+
+Blake2b::Blake2b(std::string_view personal) : h{Blake2b::initial_state(personal)}, buffer{}, buffered{0}, length{0} {}
+
+void Blake2b::update(std::span<const uint8_t> data) {
+    std::array<uint64_t, 16> m{};
+    while (!data.empty()) {
+        // a full buffer is only compressed once more input shows that it is not the last block
+        if (this->buffered == Blake2b::BLOCK_SIZE) {
+            load_block(this->buffer, 0, m);
+            compress(this->h, m, this->length, false);
+            this->buffered = 0;
+        }
+
+        const size_t n = std::min(data.size(), Blake2b::BLOCK_SIZE - this->buffered);
+        std::copy_n(data.begin(), n, this->buffer.begin() + this->buffered);
+        this->buffered += n;
+        this->length += n;
+        data = data.subspan(n);
+    }
+}
+
+Blake2b::Digest Blake2b::finalize() {
+    std::fill(this->buffer.begin() + this->buffered, this->buffer.end(), 0);
+    std::array<uint64_t, 16> m{};
+    load_block(this->buffer, 0, m);
+    compress(this->h, m, this->length, true);
+    return digest_of(this->h);
+}
+
+Blake2b::Digest Blake2b::hash(std::string_view personal, std::span<const uint8_t> message) {
+    Digest out{};
+    hash_one(Blake2b::initial_state(personal), message, out);
+    return out;
+}
+
+void Blake2b::hash_many(std::string_view personal, std::span<const std::span<const uint8_t>> messages,
+                        std::span<Digest> out, Backend backend) {
+    assert(messages.size() == out.size());
+    assert(Blake2b::is_supported(backend));
+
+    const std::array<uint64_t, 8> h0 = Blake2b::initial_state(personal);
+
+#ifdef JUBJUB_BLAKE2B_X86
+    if (backend == Backend::AVX2 && messages.size() > 1) {
+        // lanes run in lockstep, so messages of similar length are grouped together
+        std::vector<size_t> order(messages.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return block_count(messages[a].size()) < block_count(messages[b].size());
+        });
+
+        std::array<std::span<const uint8_t>, Blake2b::LANES> lanes;
+        std::array<Digest *, Blake2b::LANES> targets{};
+        for (size_t i = 0; i < order.size(); i += Blake2b::LANES) {
+            const size_t n = std::min(Blake2b::LANES, order.size() - i);
+            for (size_t l = 0; l < n; ++l) {
+                lanes[l] = messages[order[i + l]];
+                targets[l] = &out[order[i + l]];
+            }
+            avx2::hash_lanes(h0, std::span(lanes).first(n), std::span(targets).first(n));
+        }
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < messages.size(); ++i)
+        hash_one(h0, messages[i], out[i]);
+}
+
+Blake2b::Backend Blake2b::detect() noexcept {
+#ifdef JUBJUB_BLAKE2B_X86
+    if (__builtin_cpu_supports("avx2")) return Backend::AVX2;
+#endif
+    return Backend::PORTABLE;
+}
+
+bool Blake2b::is_supported(Backend backend) noexcept {
+    switch (backend) {
+        case Backend::PORTABLE:
+            return true;
+        case Backend::AVX2:
+#ifdef JUBJUB_BLAKE2B_X86
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+std::array<uint64_t, 8> Blake2b::initial_state(std::string_view personal) {
+    // checked on every build, the personalization is copied into a fixed-size block below
+    if (personal.size() > Blake2b::PERSONAL_SIZE)
+        throw std::invalid_argument("BLAKE2b personalization is longer than 16 bytes");
+
+    std::array<uint8_t, Blake2b::PERSONAL_SIZE> padded{};
+    std::copy(personal.begin(), personal.end(), padded.begin());
+
+    // parameter block: 64-byte digest, no key, fanout and depth of one, personalization in its last 16 bytes
+    std::array<uint64_t, 8> h = IV;
+    h[0] ^= 0x01010000 ^ Blake2b::OUTPUT_SIZE;
+    h[6] ^= load_le(padded.data());
+    h[7] ^= load_le(padded.data() + sizeof(uint64_t));
+    return h;
+}
+
+} // namespace jubjub::hash
\ No newline at end of file
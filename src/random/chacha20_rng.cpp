@@ -0,0 +1,150 @@
+#include "random/chacha20_rng.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+
+#include "impl/os_rng.h"
+
+namespace jubjub::random {
+
+namespace {
+
+/// "expand 32-byte k"
+constexpr std::array<uint32_t, 4> SIGMA = {0x61707865, 0x3320646e, 0x79622d32, 0x6b206574};
+
+inline void quarter_round(std::array<uint32_t, 16> &x, int a, int b, int c, int d) {
+    x[a] += x[b];
+    x[d] = std::rotl(x[d] ^ x[a], 16);
+    x[c] += x[d];
+    x[b] = std::rotl(x[b] ^ x[c], 12);
+    x[a] += x[b];
+    x[d] = std::rotl(x[d] ^ x[a], 8);
+    x[c] += x[d];
+    x[b] = std::rotl(x[b] ^ x[c], 7);
+}
+
+/// Writes one 64-byte keystream block, with a 64-bit block counter and a zero nonce.
+void block(const std::array<uint32_t, 8> &key, uint64_t counter, uint8_t *out) {
+    std::array<uint32_t, 16> state = {
+            SIGMA[0], SIGMA[1], SIGMA[2], SIGMA[3],
+            key[0], key[1], key[2], key[3],
+            key[4], key[5], key[6], key[7],
+            static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), 0, 0,
+    };
+
+    std::array<uint32_t, 16> x = state;
+    for (int i = 0; i < 10; ++i) {
+        quarter_round(x, 0, 4, 8, 12);
+        quarter_round(x, 1, 5, 9, 13);
+        quarter_round(x, 2, 6, 10, 14);
+        quarter_round(x, 3, 7, 11, 15);
+        quarter_round(x, 0, 5, 10, 15);
+        quarter_round(x, 1, 6, 11, 12);
+        quarter_round(x, 2, 7, 8, 13);
+        quarter_round(x, 3, 4, 9, 14);
+    }
+
+    for (int i = 0; i < 16; ++i) {
+        uint32_t word = x[i] + state[i];
+        if constexpr (std::endian::native == std::endian::big) word = __builtin_bswap32(word);
+        std::memcpy(out + i * sizeof(uint32_t), &word, sizeof(uint32_t));
+    }
+}
+
+} // namespace
+
+ChaCha20Rng::ChaCha20Rng() : key{}, counter{0}, until_reseed{0}, reseeding{true}, buffer{},
+                             position{ChaCha20Rng::BLOCK_SIZE * ChaCha20Rng::BUFFER_BLOCKS} {
+    this->reseed();
+}
+
+ChaCha20Rng::ChaCha20Rng(const std::array<uint8_t, ChaCha20Rng::SEED_SIZE> &seed) :
+        key{}, counter{0}, until_reseed{0}, reseeding{false}, buffer{},
+        position{ChaCha20Rng::BLOCK_SIZE * ChaCha20Rng::BUFFER_BLOCKS} {
+    this->set_key(seed);
+}
+
+ChaCha20Rng::~ChaCha20Rng() {
+    // the buffered keystream and the key would let an attacker recover past and future outputs
+    std::fill(this->key.begin(), this->key.end(), 0);
+    std::fill(this->buffer.begin(), this->buffer.end(), 0);
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+uint32_t ChaCha20Rng::next_u32() {
+    std::array<uint8_t, sizeof(uint32_t)> bytes{};
+    this->fill_bytes(bytes);
+    uint32_t value;
+    std::memcpy(&value, bytes.data(), sizeof(value));
+    return value;
+}
+
+uint64_t ChaCha20Rng::next_u64() {
+    std::array<uint8_t, sizeof(uint64_t)> bytes{};
+    this->fill_bytes(bytes);
+    uint64_t value;
+    std::memcpy(&value, bytes.data(), sizeof(value));
+    return value;
+}
+
+void ChaCha20Rng::fill_bytes(std::span<uint8_t> dest) {
+    while (!dest.empty()) {
+        if (this->reseeding && this->until_reseed == 0) this->reseed();
+
+        // serve whatever is left in the buffer first
+        size_t n = std::min(dest.size(), this->buffer.size() - this->position);
+        if (n > 0) {
+            std::copy_n(this->buffer.begin() + this->position, n, dest.begin());
+            std::fill_n(this->buffer.begin() + this->position, n, 0);
+            this->position += n;
+        } else if (dest.size() >= ChaCha20Rng::BLOCK_SIZE) {
+            // whole blocks go straight to the destination
+            n = dest.size() / ChaCha20Rng::BLOCK_SIZE * ChaCha20Rng::BLOCK_SIZE;
+            if (this->reseeding) n = std::min<size_t>(n, this->until_reseed);
+            this->generate(dest.first(n));
+        } else {
+            this->refill();
+            continue;
+        }
+
+        dest = dest.subspan(n);
+        if (this->reseeding) this->until_reseed -= std::min<uint64_t>(n, this->until_reseed);
+    }
+}
+
+void ChaCha20Rng::reseed() {
+    std::array<uint8_t, ChaCha20Rng::SEED_SIZE> seed{};
+    rng::impl::OsRng os{};
+    os.fill_bytes(seed);
+    this->set_key(seed);
+    std::fill(seed.begin(), seed.end(), 0);
+}
+
+void ChaCha20Rng::set_key(const std::array<uint8_t, ChaCha20Rng::SEED_SIZE> &seed) {
+    for (size_t i = 0; i < this->key.size(); ++i) {
+        uint32_t word;
+        std::memcpy(&word, seed.data() + i * sizeof(uint32_t), sizeof(word));
+        if constexpr (std::endian::native == std::endian::big) word = __builtin_bswap32(word);
+        this->key[i] = word;
+    }
+    this->counter = 0;
+    this->until_reseed = ChaCha20Rng::RESEED_INTERVAL;
+
+    // drop the keystream of the previous key
+    std::fill(this->buffer.begin(), this->buffer.end(), 0);
+    this->position = this->buffer.size();
+}
+
+void ChaCha20Rng::generate(std::span<uint8_t> dest) {
+    for (size_t i = 0; i < dest.size(); i += ChaCha20Rng::BLOCK_SIZE)
+        block(this->key, this->counter++, dest.data() + i);
+}
+
+void ChaCha20Rng::refill() {
+    this->generate(this->buffer);
+    this->position = 0;
+}
+
+} // namespace jubjub::random
\ No newline at end of file
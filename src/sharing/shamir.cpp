@@ -0,0 +1,152 @@
+#include "sharing/shamir.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "field/fr_vec.h"
+
+namespace jubjub::sharing {
+
+using field::Fr;
+using field::FrVec;
+
+Polynomial::Polynomial(std::vector<Fr> coefficients) : coefficients{std::move(coefficients)} {
+    assert(!this->coefficients.empty());
+}
+
+Polynomial::~Polynomial() {
+    std::fill(this->coefficients.begin(), this->coefficients.end(), Fr::zero());
+}
+
+Polynomial Polynomial::random(const Fr &secret, uint32_t threshold, rng::core::RngCore &rng) {
+    assert(threshold > 0);
+
+    std::vector<Fr> coefficients(threshold);
+    Fr::random_batch(rng, std::span(coefficients).subspan(1));
+    coefficients[0] = secret;
+    return Polynomial{std::move(coefficients)};
+}
+
+Fr Polynomial::evaluate(const Fr &x) const {
+    Fr acc = this->coefficients.back();
+    for (auto it = this->coefficients.rbegin() + 1; it != this->coefficients.rend(); ++it)
+        acc = acc * x + *it;
+    return acc;
+}
+
+void Polynomial::evaluate(std::span<const Fr> xs, std::span<Fr> out) const {
+    assert(xs.size() == out.size());
+
+    if (FrVec::pays_off(xs.size())) {
+        for (size_t i = 0; i < xs.size(); i += FrVec::CHUNK_SIZE) {
+            const size_t n = std::min(FrVec::CHUNK_SIZE, xs.size() - i);
+            const FrVec x{xs.subspan(i, n)};
+            FrVec acc(n, this->coefficients.back());
+            for (auto it = this->coefficients.rbegin() + 1; it != this->coefficients.rend(); ++it) {
+                FrVec::mul(acc, acc, x);
+                FrVec::add(acc, acc, FrVec(n, *it));
+            }
+            for (size_t j = 0; j < n; ++j)
+                out[i + j] = acc.get(j);
+        }
+        return;
+    }
+
+    // Horner steps run across all points before moving to the next coefficient, so the chains interleave
+    std::fill(out.begin(), out.end(), this->coefficients.back());
+    for (auto it = this->coefficients.rbegin() + 1; it != this->coefficients.rend(); ++it)
+        for (size_t j = 0; j < xs.size(); ++j)
+            out[j] = out[j] * xs[j] + *it;
+}
+
+std::vector<Share> Polynomial::split(uint32_t count) const {
+    std::vector<Fr> xs(count);
+    for (uint32_t i = 0; i < count; ++i)
+        xs[i] = Fr{i + 1};
+
+    std::vector<Fr> ys(count);
+    this->evaluate(xs, ys);
+
+    std::vector<Share> shares;
+    shares.reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+        shares.push_back(Share{xs[i], ys[i]});
+    return shares;
+}
+
+size_t Polynomial::threshold() const {
+    return this->coefficients.size();
+}
+
+const std::vector<Fr> &Polynomial::get_coefficients() const {
+    return this->coefficients;
+}
+
+SignerSet::SignerSet(std::vector<Fr> indices, std::vector<Fr> coefficients)
+        : indices{std::move(indices)}, coefficients{std::move(coefficients)} {}
+
+std::optional<SignerSet> SignerSet::from_indices(std::span<const Fr> indices) {
+    if (indices.empty()) return std::nullopt;
+
+    // l_i = prod_{j != i} x_j / (x_j - x_i) = prod_j x_j / (x_i * prod_{j != i} (x_j - x_i))
+    Fr product = Fr::one();
+    std::vector<Fr> denominators(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        product *= indices[i];
+
+        Fr denominator = indices[i];
+        for (size_t j = 0; j < indices.size(); ++j)
+            if (j != i) denominator *= indices[j] - indices[i];
+        denominators[i] = denominator;
+    }
+
+    // a zero or repeated index zeroes a denominator, which batch inversion would leave in place
+    if (std::any_of(denominators.begin(), denominators.end(), [](const Fr &d) { return d.is_zero(); }))
+        return std::nullopt;
+
+    Fr::batch_invert(denominators);
+    for (Fr &coefficient: denominators)
+        coefficient *= product;
+
+    return SignerSet{std::vector<Fr>(indices.begin(), indices.end()), std::move(denominators)};
+}
+
+Fr SignerSet::interpolate(std::span<const Fr> values) const {
+    assert(values.size() == this->coefficients.size());
+    return Fr::sum_of_products(this->coefficients, values);
+}
+
+std::optional<Fr> SignerSet::reconstruct(std::span<const Share> shares) const {
+    if (shares.size() != this->indices.size()) return std::nullopt;
+
+    std::vector<Fr> values(shares.size());
+    for (size_t i = 0; i < shares.size(); ++i) {
+        if (shares[i].index != this->indices[i]) return std::nullopt;
+        values[i] = shares[i].value;
+    }
+    return this->interpolate(values);
+}
+
+size_t SignerSet::size() const {
+    return this->indices.size();
+}
+
+const std::vector<Fr> &SignerSet::get_indices() const {
+    return this->indices;
+}
+
+const std::vector<Fr> &SignerSet::get_coefficients() const {
+    return this->coefficients;
+}
+
+std::optional<Fr> reconstruct(std::span<const Share> shares) {
+    std::vector<Fr> indices(shares.size());
+    for (size_t i = 0; i < shares.size(); ++i)
+        indices[i] = shares[i].index;
+
+    const auto signers = SignerSet::from_indices(indices);
+    if (!signers.has_value()) return std::nullopt;
+    return signers->reconstruct(shares);
+}
+
+} // namespace jubjub::sharing
\ No newline at end of file
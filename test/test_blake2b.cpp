@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "hash/blake2b.h"
+
+using jubjub::hash::Blake2b;
+
+static Blake2b::Digest from_hex(const std::string &hex) {
+    Blake2b::Digest out{};
+    for (size_t i = 0; i < out.size(); ++i)
+        out[i] = static_cast<uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+    return out;
+}
+
+static std::vector<uint8_t> counting(size_t n) {
+    std::vector<uint8_t> bytes(n);
+    for (size_t i = 0; i < n; ++i)
+        bytes[i] = static_cast<uint8_t>(i);
+    return bytes;
+}
+
+TEST(Blake2b, Vectors) {
+    const std::string abc = "abc";
+    EXPECT_EQ(Blake2b::hash({}, std::span(reinterpret_cast<const uint8_t *>(abc.data()), abc.size())),
+              from_hex("ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d1"
+                       "7d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923"));
+
+    EXPECT_EQ(Blake2b::hash("Jubjub", {}),
+              from_hex("4ebee666d60a3c1c63341053ce0aa965b6f502175a5e8cbd4315ec4de866d07b"
+                       "fffebb8a1bec246b3b2c664df5cc6ff3d7eb344b15f501990a78a923fbde62aa"));
+
+    EXPECT_EQ(Blake2b::hash("Zcash_RedJubjubH", counting(200)),
+              from_hex("c6898263233689be170df510c6d50b9edcd129115b710bff3515424dce5d2934"
+                       "ed32e926cb655c9b7c1d6740390286c33bfd3643845a1f9b4274dfc92de90983"));
+}
+
+TEST(Blake2b, Streaming) {
+    const std::vector<uint8_t> message = counting(1000);
+    for (size_t step: {1, 7, 128, 129, 1000}) {
+        Blake2b hasher{"Jubjub"};
+        for (size_t i = 0; i < message.size(); i += step)
+            hasher.update(std::span(message).subspan(i, std::min(step, message.size() - i)));
+        EXPECT_EQ(hasher.finalize(), Blake2b::hash("Jubjub", message));
+    }
+}
+
+TEST(Blake2b, PersonalSize) {
+    const std::vector<uint8_t> message = counting(10);
+    EXPECT_NO_THROW(std::ignore = Blake2b::hash(std::string(Blake2b::PERSONAL_SIZE, 'x'), message));
+    EXPECT_THROW(Blake2b{std::string(Blake2b::PERSONAL_SIZE + 1, 'x')}, std::invalid_argument);
+    EXPECT_THROW(std::ignore = Blake2b::hash(std::string(Blake2b::PERSONAL_SIZE + 1, 'x'), message),
+                 std::invalid_argument);
+}
+
+TEST(Blake2b, HashMany) {
+    // lengths around the block boundaries, in an order that mixes short and long lanes
+    const std::vector<size_t> lengths = {300, 0, 128, 1, 129, 256, 127, 1000, 64, 255, 3};
+    std::vector<std::vector<uint8_t>> storage;
+    std::vector<std::span<const uint8_t>> messages;
+    for (size_t length: lengths)
+        storage.push_back(counting(length));
+    for (const auto &message: storage)
+        messages.emplace_back(message);
+
+    for (auto backend: {Blake2b::Backend::PORTABLE, Blake2b::Backend::AVX2}) {
+        if (!Blake2b::is_supported(backend)) continue;
+
+        std::vector<Blake2b::Digest> digests(messages.size());
+        Blake2b::hash_many("Jubjub", messages, digests, backend);
+        for (size_t i = 0; i < messages.size(); ++i)
+            EXPECT_EQ(digests[i], Blake2b::hash("Jubjub", messages[i]));
+    }
+}
\ No newline at end of file
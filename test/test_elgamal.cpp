@@ -8,11 +8,13 @@
 #include "field/fr.h"
 #include "group/extended.h"
 #include "group/constants.h"
+#include "group/fixed_base_cache.h"
 
 using rng::impl::OsRng;
 using jubjub::elgamal::Cipher;
 using jubjub::field::Fr;
 using jubjub::group::Extended;
+using jubjub::group::FixedBaseCache;
 using jubjub::group::constant::GENERATOR_EXTENDED;
 
 std::tuple<Fr, Extended, Fr, Extended> generate() {
@@ -39,6 +41,24 @@ TEST(ElGamal, Enc) {
     EXPECT_EQ(m_g, decrypt);
 }
 
+TEST(ElGamal, EncCached) {
+    auto [a, _, b, b_g] = generate();
+
+    OsRng rng{};
+    const Extended m_g = GENERATOR_EXTENDED * Fr::random(rng);
+
+    // the first encryption misses and the second admits the key, later ones read its table
+    FixedBaseCache cache{4 * FixedBaseCache::TABLE_BYTES, 2};
+    for (int i = 0; i < 3; ++i) {
+        const Cipher cipher = Cipher::encrypt(a, b_g, GENERATOR_EXTENDED, m_g, cache);
+        EXPECT_EQ(cipher.get_gamma(), Cipher::encrypt(a, b_g, GENERATOR_EXTENDED, m_g).get_gamma());
+        EXPECT_EQ(cipher.get_delta(), Cipher::encrypt(a, b_g, GENERATOR_EXTENDED, m_g).get_delta());
+        EXPECT_EQ(cipher.decrypt(b), m_g);
+    }
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(FixedBaseCache::global().size(), 0);
+}
+
 TEST(ElGamal, EncWrongKey) {
     auto [a, _, b, b_g] = generate();
 
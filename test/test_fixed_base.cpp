@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "impl/os_rng.h"
+
+#include "field/fr.h"
+#include "group/constants.h"
+#include "group/extended.h"
+#include "group/fixed_base.h"
+#include "group/fixed_base_cache.h"
+
+using rng::impl::OsRng;
+
+using jubjub::field::Fr;
+using jubjub::group::Extended;
+using jubjub::group::FixedBaseCache;
+using jubjub::group::FixedBaseTable;
+
+using jubjub::group::constant::GENERATOR_EXTENDED;
+using jubjub::group::constant::GENERATOR_NUMS_EXTENDED;
+using jubjub::group::constant::FR_MODULUS_BYTES;
+
+TEST(FixedBase, Generators) {
+    OsRng rng{};
+    for (int i = 0; i < 20; ++i) {
+        const Fr s = Fr::random(rng);
+        EXPECT_EQ(FixedBaseTable::generator().multiply(s), GENERATOR_EXTENDED * s);
+        EXPECT_EQ(FixedBaseTable::generator_nums().multiply(s), GENERATOR_NUMS_EXTENDED * s);
+    }
+
+    EXPECT_EQ(FixedBaseTable::find(GENERATOR_EXTENDED), &FixedBaseTable::generator());
+    EXPECT_EQ(FixedBaseTable::find(GENERATOR_NUMS_EXTENDED.doubles() - GENERATOR_NUMS_EXTENDED),
+              &FixedBaseTable::generator_nums());
+    EXPECT_EQ(FixedBaseTable::find(GENERATOR_EXTENDED.doubles()), nullptr);
+}
+
+TEST(FixedBase, EdgeScalars) {
+    const Extended base = GENERATOR_EXTENDED.doubles();
+    const FixedBaseTable table{base};
+
+    std::vector<std::array<uint8_t, 32>> scalars{{}, FR_MODULUS_BYTES};
+    scalars.push_back({1});
+    scalars.push_back({8});
+    scalars.push_back({0xf8});
+    scalars.emplace_back().fill(0xff);
+    for (const auto &by: scalars)
+        EXPECT_EQ(table.multiply(by), base.multiply(by));
+
+    EXPECT_TRUE(table.multiply(Fr::zero()).is_identity());
+    EXPECT_EQ(table.multiply(-Fr::one()), -base);
+}
+
+TEST(FixedBase, ConcurrentFirstUse) {
+    const Fr s{12345ULL};
+    const Extended expected = GENERATOR_NUMS_EXTENDED * s;
+
+    std::vector<std::thread> threads;
+    std::array<bool, 4> results{};
+    for (size_t i = 0; i < results.size(); ++i)
+        threads.emplace_back([&, i]() { results[i] = FixedBaseTable::generator_nums().multiply(s) == expected; });
+    for (std::thread &thread: threads)
+        thread.join();
+
+    for (bool result: results)
+        EXPECT_TRUE(result);
+}
+
+TEST(FixedBase, CacheAdmission) {
+    FixedBaseCache cache{8 * FixedBaseCache::TABLE_BYTES, 2};
+    const Extended base = GENERATOR_EXTENDED.doubles();
+    const Fr s{777ULL};
+
+    EXPECT_EQ(cache.get(base), nullptr);
+    EXPECT_EQ(cache.size(), 0);
+
+    const auto table = cache.get(base);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(cache.get(base), table);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(table->multiply(s), base * s);
+    EXPECT_EQ(cache.multiply(base, s), base * s);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.get(base), nullptr);
+}
+
+TEST(FixedBase, CacheEviction) {
+    FixedBaseCache cache{2 * FixedBaseCache::TABLE_BYTES, 1};
+    const Extended a = GENERATOR_EXTENDED.doubles();
+    const Extended b = a.doubles();
+    const Extended c = b.doubles();
+
+    const auto table_a = cache.get(a);
+    const auto table_b = cache.get(b);
+    ASSERT_NE(table_a, nullptr);
+    ASSERT_NE(table_b, nullptr);
+
+    // touching a leaves b as the least recently used entry
+    EXPECT_EQ(cache.get(a), table_a);
+    EXPECT_NE(cache.get(c), nullptr);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.get(a), table_a);
+    EXPECT_NE(cache.get(b), table_b);
+
+    // evicted tables stay valid for their holders
+    const Fr s{31337ULL};
+    EXPECT_EQ(table_b->multiply(s), b * s);
+
+    cache.set_max_bytes(FixedBaseCache::TABLE_BYTES);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.get_max_bytes(), FixedBaseCache::TABLE_BYTES);
+
+    cache.set_max_bytes(0);
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.get(a), nullptr);
+}
+
+TEST(FixedBase, CacheConcurrent) {
+    FixedBaseCache cache{3 * FixedBaseCache::TABLE_BYTES, 1};
+
+    std::vector<Extended> bases{GENERATOR_EXTENDED};
+    for (int i = 0; i < 4; ++i)
+        bases.push_back(bases.back().doubles());
+
+    const Fr s{4242ULL};
+    std::vector<Extended> expected;
+    for (const Extended &base: bases)
+        expected.push_back(base * s);
+
+    // five points over three slots keep the writers evicting while readers hit
+    std::vector<std::thread> threads;
+    std::array<bool, 4> results{};
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&, t]() {
+            bool ok = true;
+            for (size_t i = 0; i < 12; ++i) {
+                const size_t k = (i * (t + 1)) % bases.size();
+                ok &= cache.multiply(bases[k], s) == expected[k];
+            }
+            results[t] = ok;
+        });
+    }
+    for (std::thread &thread: threads)
+        thread.join();
+
+    for (bool result: results)
+        EXPECT_TRUE(result);
+    EXPECT_LE(cache.size(), 3);
+}
+
+TEST(FixedBase, CacheReclaim) {
+    FixedBaseCache cache{2 * FixedBaseCache::TABLE_BYTES, 1};
+    const std::array<Extended, 3> bases{GENERATOR_EXTENDED, GENERATOR_EXTENDED.doubles(), -GENERATOR_EXTENDED};
+    const Fr s{99ULL};
+
+    // readers keep guarding snapshots while the writer replaces and frees them
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+    std::array<bool, 3> results{};
+    for (size_t t = 0; t < results.size(); ++t) {
+        readers.emplace_back([&, t]() {
+            bool ok = true;
+            for (size_t i = 0; !done.load() || i < 8; ++i) {
+                const Extended &base = bases[(i + t) % bases.size()];
+                ok &= cache.multiply(base, s) == base * s;
+                ok &= cache.size() <= 2;
+            }
+            results[t] = ok;
+        });
+    }
+    for (int i = 0; i < 20; ++i) {
+        cache.clear();
+        cache.set_max_bytes((i % 3) * FixedBaseCache::TABLE_BYTES);
+    }
+    done.store(true);
+    for (std::thread &reader: readers)
+        reader.join();
+
+    for (bool result: results)
+        EXPECT_TRUE(result);
+}
\ No newline at end of file
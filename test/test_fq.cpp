@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "impl/os_rng.h"
+
+#include "field/fq.h"
+
+using rng::impl::OsRng;
+
+using bls12_381::scalar::Scalar;
+using jubjub::field::Fq;
+
+TEST(Fq, Conversion) {
+    OsRng rng{};
+    for (int i = 0; i < 100; ++i) {
+        const Scalar scalar = Scalar::random(rng);
+        EXPECT_EQ(Fq{scalar}.to_scalar(), scalar);
+    }
+    EXPECT_EQ(Fq::one().to_scalar(), Scalar::one());
+    EXPECT_EQ(Fq::zero().to_scalar(), Scalar::zero());
+}
+
+TEST(Fq, MatchesScalar) {
+    OsRng rng{};
+    for (int i = 0; i < 1000; ++i) {
+        const Scalar a = Scalar::random(rng);
+        const Scalar b = Scalar::random(rng);
+        const Fq x{a};
+        const Fq y{b};
+
+        EXPECT_EQ((x + y).to_scalar(), a + b);
+        EXPECT_EQ((x - y).to_scalar(), a - b);
+        EXPECT_EQ((x * y).to_scalar(), a * b);
+        EXPECT_EQ(x.square().to_scalar(), a.square());
+        EXPECT_EQ(x.doubles().to_scalar(), a.doubles());
+        EXPECT_EQ((-x).to_scalar(), -a);
+    }
+    EXPECT_EQ(-Fq::zero(), Fq::zero());
+}
+
+TEST(Fq, Invert) {
+    OsRng rng{};
+    for (int i = 0; i < 100; ++i) {
+        const Fq x{Scalar::random(rng)};
+        EXPECT_EQ(x * x.invert().value(), Fq::one());
+    }
+    EXPECT_EQ(Fq::one().invert().value(), Fq::one());
+    EXPECT_FALSE(Fq::zero().invert().has_value());
+}
+
+TEST(Fq, Lazy) {
+    OsRng rng{};
+    const Fq max{{Fq::MODULUS_LIMBS[0] - 1, Fq::MODULUS_LIMBS[1], Fq::MODULUS_LIMBS[2], Fq::MODULUS_LIMBS[3]}};
+    std::vector<Fq> values{Fq::zero(), Fq::one(), max};
+    for (int i = 0; i < 1000; ++i)
+        values.emplace_back(Scalar::random(rng));
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        const Fq &x = values[i];
+        const Fq &y = values[(i * 7 + 1) % values.size()];
+
+        EXPECT_EQ(x.add_lazy(y).reduce(), x + y);
+        EXPECT_EQ(x.sub_lazy(y).reduce(), x - y);
+        EXPECT_EQ(x.mul_lazy(y).reduce(), x * y);
+
+        // redundant values are accepted as the right operand of a multiplication
+        EXPECT_EQ(max * x.add_lazy(y), max * (x + y));
+        EXPECT_EQ(max * x.sub_lazy(y), max * (x - y));
+        EXPECT_EQ(max * x.mul_lazy(y), max * (x * y));
+        EXPECT_EQ(max.mul_lazy(max.add_lazy(max)).reduce(), max * (max + max));
+    }
+}
\ No newline at end of file
@@ -1,11 +1,22 @@
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
 #include "impl/os_rng.h"
 
 #include "field/constant.h"
+#include "field/exponent.h"
+#include "field/recode.h"
+#include "field/montgomery.h"
 #include "group/affine.h"
 #include "group/extended.h"
 #include "group/constants.h"
+#include "random/chacha20_rng.h"
 
 using rng::impl::OsRng;
 
@@ -20,6 +31,9 @@ using jubjub::group::Affine;
 using jubjub::group::Extended;
 
 using jubjub::group::constant::GENERATOR;
+using jubjub::group::constant::FR_MODULUS_BYTES;
+
+using jubjub::random::ChaCha20Rng;
 
 TEST(Fr, Inv) {
     uint64_t inv = 1;
@@ -31,6 +45,17 @@ TEST(Fr, Inv) {
     EXPECT_EQ(inv, INV);
 }
 
+TEST(Fr, IntegerConstructors) {
+    static_assert(std::is_constructible_v<Fr, int8_t>);
+    static_assert(std::is_constructible_v<Fr, uint8_t>);
+    static_assert(std::is_constructible_v<Fr, uint64_t>);
+    static_assert(!std::is_constructible_v<Fr, int>);
+    static_assert(!std::is_constructible_v<Fr, int64_t>);
+
+    EXPECT_EQ(Fr{int8_t{-3}}, -Fr{int8_t{3}});
+    EXPECT_EQ(Fr{300U}, Fr{uint64_t{300}});
+}
+
 TEST(Fr, Equality) {
     EXPECT_EQ(Fr::zero(), Fr::zero());
     EXPECT_EQ(Fr::one(), Fr::one());
@@ -313,6 +338,40 @@ TEST(Fr, Squaring) {
     }
 }
 
+TEST(Fr, MontgomeryBackends) {
+#ifdef JUBJUB_MONTGOMERY_MULX_ADX
+    namespace montgomery = jubjub::field::montgomery;
+    if (montgomery::detect() != montgomery::Backend::MULX_ADX) GTEST_SKIP();
+
+    const montgomery::Limbs modulus = {
+            0xd0970e5ed6f72cb7, 0xa6682093ccc81082,
+            0x06673b0101343b00, 0x0e7db4ea6533afa9,
+    };
+    const auto limbs = [](const Fr &fr) {
+        const auto bytes = fr.to_bytes();
+        montgomery::Limbs res{};
+        for (int i = 0; i < 32; ++i)
+            res[i / 8] |= static_cast<uint64_t>(bytes[i]) << (8 * (i % 8));
+        return res;
+    };
+
+    OsRng rng{};
+    std::vector<montgomery::Limbs> values = {limbs(Fr::zero()), limbs(Fr::one()), limbs(-Fr::one()), limbs(LARGEST)};
+    for (int i = 0; i < 1000; ++i)
+        values.push_back(limbs(Fr::random(rng)));
+
+    for (const auto &a: values) {
+        EXPECT_EQ(montgomery::portable::square(a, modulus, INV), montgomery::mulx_adx::square(a, modulus, INV));
+        const montgomery::WideLimbs wide = {a[0], a[1], a[2], a[3], a[3], a[2], a[1], 0};
+        EXPECT_EQ(montgomery::portable::reduce(wide, modulus, INV), montgomery::mulx_adx::reduce(wide, modulus, INV));
+        for (const auto &b: {values[0], values[2], values[values.size() - 1]})
+            EXPECT_EQ(montgomery::portable::mul(a, b, modulus, INV), montgomery::mulx_adx::mul(a, b, modulus, INV));
+    }
+#else
+    GTEST_SKIP();
+#endif
+}
+
 TEST(Fr, Inversion) {
     EXPECT_FALSE(Fr::zero().invert().has_value());
     EXPECT_EQ(Fr::one().invert().value(), Fr::one());
@@ -327,6 +386,134 @@ TEST(Fr, Inversion) {
     }
 }
 
+TEST(Fr, InversionMethods) {
+    EXPECT_FALSE(Fr::zero().invert(Fr::Inversion::SAFEGCD).has_value());
+    EXPECT_FALSE(Fr::zero().invert(Fr::Inversion::ADDITION_CHAIN).has_value());
+    EXPECT_EQ(Fr::one().invert(Fr::Inversion::SAFEGCD).value(), Fr::one());
+    EXPECT_EQ(LARGEST.invert(Fr::Inversion::SAFEGCD).value(), LARGEST.invert(Fr::Inversion::ADDITION_CHAIN).value());
+
+    OsRng rng{};
+    for (int i = 0; i < 1000; ++i) {
+        const Fr a = Fr::random(rng);
+        EXPECT_EQ(a.invert(Fr::Inversion::SAFEGCD), a.invert(Fr::Inversion::ADDITION_CHAIN));
+    }
+
+    Fr temp = R2;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(temp.invert(Fr::Inversion::SAFEGCD), temp.invert(Fr::Inversion::ADDITION_CHAIN));
+        temp += R2;
+    }
+}
+
+TEST(Fr, BatchInvert) {
+    OsRng rng{};
+    std::vector<Fr> values;
+    for (int i = 0; i < 100; ++i)
+        values.push_back(i % 7 == 0 ? Fr::zero() : Fr::random(rng));
+
+    std::vector<Fr> expected;
+    for (const Fr &value: values)
+        expected.push_back(value.is_zero() ? Fr::zero() : value.invert().value());
+
+    Fr::batch_invert(values);
+    EXPECT_EQ(values, expected);
+
+    std::vector<Fr> empty;
+    Fr::batch_invert(empty);
+    EXPECT_TRUE(empty.empty());
+
+    std::vector<Fr> zeros(3, Fr::zero());
+    Fr::batch_invert(zeros);
+    EXPECT_EQ(zeros, std::vector<Fr>(3, Fr::zero()));
+}
+
+TEST(Fr, BatchInvertParallel) {
+    OsRng rng{};
+    std::vector<Fr> values;
+    for (int i = 0; i < 5000; ++i)
+        values.push_back(i % 13 == 0 ? Fr::zero() : Fr::random(rng));
+
+    std::vector<Fr> expected = values;
+    Fr::batch_invert(expected);
+
+    Fr::batch_invert(values, 4);
+    EXPECT_EQ(values, expected);
+}
+
+TEST(Fr, Sum) {
+    OsRng rng{};
+    EXPECT_EQ(Fr::sum({}), Fr::zero());
+
+    for (const size_t n: {1, 2, 17, 300}) {
+        std::vector<Fr> values(n, -Fr::one());
+        Fr expected = Fr::zero();
+        for (size_t i = 0; i < n; ++i) {
+            if (i % 2 == 1) values[i] = Fr::random(rng);
+            expected += values[i];
+        }
+        EXPECT_EQ(Fr::sum(values), expected);
+    }
+}
+
+TEST(Fr, SumOfProducts) {
+    OsRng rng{};
+    EXPECT_EQ(Fr::sum_of_products({}, {}), Fr::zero());
+
+    for (const size_t n: {1, 15, 16, 17, 33, 300}) {
+        std::vector<Fr> a(n, -Fr::one());
+        std::vector<Fr> b(n, -Fr::one());
+        Fr expected = Fr::zero();
+        for (size_t i = 0; i < n; ++i) {
+            if (i % 3 != 0) {
+                a[i] = Fr::random(rng);
+                b[i] = Fr::random(rng);
+            }
+            expected += a[i] * b[i];
+        }
+        EXPECT_EQ(Fr::sum_of_products(a, b), expected);
+    }
+}
+
+TEST(Fr, PowVartime) {
+    OsRng rng{};
+    const Fr a = Fr::random(rng);
+
+    EXPECT_EQ(a.pow_vartime({0, 0, 0, 0}), Fr::one());
+    EXPECT_EQ(a.pow_vartime({1, 0, 0, 0}), a);
+    EXPECT_EQ(a.pow_vartime({0, 0, 0, 0x8000000000000000}), a.pow({0, 0, 0, 0x8000000000000000}));
+
+    for (int i = 0; i < 50; ++i) {
+        const Fr b = Fr::random(rng);
+        const std::array<uint64_t, Fr::WIDTH> exps[] = {
+                {rng.next_u64() & 0xffff, 0, 0, 0},
+                {rng.next_u64(), 0, 0, 0},
+                {rng.next_u64(), rng.next_u64(), rng.next_u64(), 0},
+                {rng.next_u64(), rng.next_u64(), rng.next_u64(), rng.next_u64()},
+        };
+        for (const auto &exp: exps)
+            EXPECT_EQ(b.pow_vartime(exp), b.pow(exp));
+    }
+}
+
+TEST(Fr, MultiPowVartime) {
+    OsRng rng{};
+    EXPECT_EQ(Fr::multi_pow_vartime({}, {}), Fr::one());
+
+    std::vector<Fr> bases;
+    std::vector<std::array<uint64_t, Fr::WIDTH>> exps;
+    Fr expected = Fr::one();
+    for (int i = 0; i < 7; ++i) {
+        bases.push_back(Fr::random(rng));
+        // mix exponents of different lengths, including a zero one
+        std::array<uint64_t, Fr::WIDTH> exp = {rng.next_u64(), rng.next_u64(), 0, 0};
+        if (i % 3 == 0) exp[3] = rng.next_u64();
+        if (i == 4) exp = {0, 0, 0, 0};
+        exps.push_back(exp);
+        expected *= bases.back().pow(exp);
+    }
+    EXPECT_EQ(Fr::multi_pow_vartime(bases, exps), expected);
+}
+
 TEST(Fr, InversionIsPow) {
     const std::array<uint64_t, 4> r_min_2{
             0xd0970e5ed6f72cb5, 0xa6682093ccc81082,
@@ -362,6 +549,42 @@ TEST(Fr, Sqrt) {
     EXPECT_EQ(47, none_count);
 }
 
+TEST(Fr, Legendre) {
+    EXPECT_EQ(Fr::zero().legendre(), 0);
+    EXPECT_EQ(Fr::one().legendre(), 1);
+    EXPECT_EQ((-Fr::one()).legendre(), -1);
+    EXPECT_TRUE(Fr::zero().is_square());
+
+    OsRng rng{};
+    for (int i = 0; i < 100; ++i) {
+        const Fr a = Fr::random(rng);
+        EXPECT_EQ(a.square().legendre(), a.is_zero() ? 0 : 1);
+        EXPECT_EQ(a.is_square(), a.sqrt().has_value());
+    }
+}
+
+TEST(Fr, FixedExponent) {
+    using jubjub::field::exponent::Chain;
+    using jubjub::field::exponent::Exponent;
+
+    constexpr Exponent SMALL = {0x1d, 0, 0, 0};
+    constexpr Exponent SPARSE = {0x8000000000000001, 0, 0, 0x0100000000000000};
+    constexpr Exponent DENSE = {0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0fffffffffffffff};
+    constexpr Exponent R_MIN_2 = {0xd0970e5ed6f72cb5, 0xa6682093ccc81082, 0x06673b0101343b00, 0x0e7db4ea6533afa9};
+
+    static_assert(Chain<R_MIN_2>::OPERATIONS < 252 + 126);
+
+    OsRng rng{};
+    for (int i = 0; i < 20; ++i) {
+        const Fr a = Fr::random(rng);
+        EXPECT_EQ(Chain<SMALL>::pow(a), a.pow(SMALL));
+        EXPECT_EQ(Chain<SPARSE>::pow(a), a.pow(SPARSE));
+        EXPECT_EQ(Chain<DENSE>::pow(a), a.pow(DENSE));
+        EXPECT_EQ(Chain<R_MIN_2>::pow(a), a.pow(R_MIN_2));
+    }
+    EXPECT_EQ(Chain<R_MIN_2>::pow(Fr::zero()), Fr::zero());
+}
+
 TEST(Fr, NAF) {
     const Fr fr{1122334455ULL};
     const std::array<int8_t, 31> naf3_fr = {
@@ -377,6 +600,58 @@ TEST(Fr, NAF) {
     EXPECT_EQ(naf3_fr, buf);
 }
 
+// Fr(int8_t) keeps the raw limbs, so digits are lifted into Montgomery form by hand
+static Fr from_digit(int8_t digit) {
+    const Fr magnitude{static_cast<uint64_t>(std::abs(digit))};
+    return digit < 0 ? -magnitude : magnitude;
+}
+
+TEST(Fr, WNAF) {
+    OsRng rng{};
+    const Fr values[] = {Fr::zero(), Fr::one(), -Fr::one(), Fr{1122334455ULL}, Fr::random(rng), Fr::random(rng)};
+    for (const Fr &value: values) {
+        for (uint8_t width = 2; width <= 8; ++width) {
+            std::array<int8_t, 256> digits{};
+            const size_t length = value.wnaf(width, digits);
+
+            Fr acc = Fr::zero();
+            for (size_t i = length; i-- > 0;)
+                acc = acc.doubles() + from_digit(digits[i]);
+            EXPECT_EQ(acc, value);
+
+            if (length > 0) EXPECT_NE(digits[length - 1], 0);
+            for (size_t i = 0; i < length; ++i) {
+                if (digits[i] == 0) continue;
+                EXPECT_EQ(digits[i] & 1, 1);
+                EXPECT_LT(std::abs(digits[i]), 1 << (width - 1));
+                for (size_t j = i + 1; j < std::min<size_t>(i + width, 256); ++j)
+                    EXPECT_EQ(digits[j], 0);
+            }
+            EXPECT_EQ(value.compute_windowed_non_adjacent(width), digits);
+        }
+    }
+}
+
+TEST(Fr, Radix2w) {
+    OsRng rng{};
+    const Fr values[] = {Fr::zero(), Fr::one(), -Fr::one(), Fr::random(rng), Fr::random(rng)};
+    for (const Fr &value: values) {
+        for (uint8_t width = 2; width <= 8; ++width) {
+            std::array<int8_t, 256> digits{};
+            const size_t length = value.radix_2w(width, digits);
+            EXPECT_EQ(length, jubjub::field::recode::radix_2w_length(width));
+
+            const Fr radix{static_cast<uint64_t>(1) << width};
+            Fr acc = Fr::zero();
+            for (size_t i = length; i-- > 0;) {
+                EXPECT_LE(std::abs(digits[i]), 1 << (width - 1));
+                acc = acc * radix + from_digit(digits[i]);
+            }
+            EXPECT_EQ(acc, value);
+        }
+    }
+}
+
 TEST(Fr, FromBytes2) {
     OsRng rng{};
     for (int i = 0; i < 1000; ++i) {
@@ -385,6 +660,142 @@ TEST(Fr, FromBytes2) {
     }
 }
 
+TEST(Fr, EncodeDecodeBatch) {
+    OsRng rng{};
+    for (const size_t n: {0, 3, 2000}) {
+        std::vector<Fr> values(n);
+        for (auto &value: values)
+            value = Fr::random(rng);
+
+        std::vector<uint8_t> bytes(n * Fr::BYTE_SIZE);
+        Fr::encode_batch(values, bytes);
+        for (size_t i = 0; i < n; ++i) {
+            const auto expected = values[i].to_bytes();
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(), bytes.begin() + i * Fr::BYTE_SIZE));
+        }
+
+        std::vector<Fr> decoded(n);
+        EXPECT_EQ(Fr::decode_batch(bytes, decoded), n);
+        EXPECT_EQ(decoded, values);
+    }
+}
+
+TEST(Fr, DecodeBatchRejectsNonCanonical) {
+    OsRng rng{};
+    const size_t n = 100;
+    std::vector<Fr> values(n);
+    for (auto &value: values)
+        value = Fr::random(rng);
+
+    std::vector<uint8_t> bytes(n * Fr::BYTE_SIZE);
+    Fr::encode_batch(values, bytes);
+
+    // the modulus itself and an all-ones encoding
+    std::copy(FR_MODULUS_BYTES.begin(), FR_MODULUS_BYTES.end(), bytes.begin() + 41 * Fr::BYTE_SIZE);
+    std::fill(bytes.begin() + 77 * Fr::BYTE_SIZE, bytes.begin() + 78 * Fr::BYTE_SIZE, 0xff);
+
+    std::vector<Fr> decoded(n);
+    EXPECT_EQ(Fr::decode_batch(bytes, decoded), 41);
+    for (size_t i = 0; i < n; ++i)
+        EXPECT_EQ(decoded[i], i == 41 || i == 77 ? Fr::zero() : values[i]);
+}
+
+TEST(Fr, FromU64Batch) {
+    OsRng rng{};
+    std::vector<uint64_t> values(100);
+    for (auto &value: values)
+        value = rng.next_u64();
+    values[0] = 0;
+    values[1] = UINT64_MAX;
+
+    std::vector<Fr> out(values.size());
+    Fr::from_u64_batch(values, out);
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(out[i], Fr{values[i]});
+}
+
+TEST(Fr, RandomBatch) {
+    std::array<uint8_t, ChaCha20Rng::SEED_SIZE> seed{};
+    OsRng{}.fill_bytes(seed);
+
+    // 300 values span two chunks, the second one partial
+    ChaCha20Rng batch_rng{seed};
+    std::vector<Fr> values(300);
+    Fr::random_batch(batch_rng, values);
+
+    ChaCha20Rng rng{seed};
+    for (const Fr &value: values)
+        EXPECT_EQ(value, Fr::random(rng));
+    EXPECT_EQ(batch_rng.next_u64(), rng.next_u64());
+}
+
+TEST(Fr, FromBytesWideReduction) {
+    OsRng rng{};
+    std::vector<std::array<uint8_t, Fr::BYTE_SIZE * 2>> inputs(100);
+    for (auto &input: inputs)
+        rng.fill_bytes(input);
+
+    // a value at or above MODULUS * 2^256 makes the REDC overflow
+    inputs[0].fill(0);
+    inputs[1].fill(0xff);
+    std::fill(inputs[2].begin() + Fr::BYTE_SIZE, inputs[2].end(), 0xff);
+    std::fill(inputs[3].begin() + Fr::BYTE_SIZE, inputs[3].end(), 0);
+
+    for (const auto &input: inputs) {
+        std::array<uint64_t, Fr::WIDTH * 2> limbs{};
+        std::memcpy(limbs.data(), input.data(), input.size());
+        const Fr expected = Fr{{limbs[0], limbs[1], limbs[2], limbs[3]}} * R2
+                            + Fr{{limbs[4], limbs[5], limbs[6], limbs[7]}} * R3;
+        EXPECT_EQ(Fr::from_bytes_wide(input), expected);
+    }
+}
+
+TEST(Fr, HashToScalar) {
+    std::vector<uint8_t> message(200);
+    for (size_t i = 0; i < message.size(); ++i)
+        message[i] = static_cast<uint8_t>(i);
+
+    const Fr expected = Fr::from_bytes(
+            {
+                    0x4a, 0xbb, 0xa7, 0x3b, 0x28, 0x4f, 0x60, 0x60, 0x4e, 0xe2, 0x9a, 0xf2, 0x34, 0xf2, 0x0d, 0xe4,
+                    0x81, 0xda, 0x2d, 0x37, 0x73, 0x21, 0xd2, 0xdf, 0x86, 0x59, 0xa2, 0x5c, 0xd6, 0xe2, 0xdf, 0x08,
+            }
+    ).value();
+    EXPECT_EQ(Fr::hash_to_scalar("Zcash_RedJubjubH", message), expected);
+
+    std::vector<std::span<const uint8_t>> messages;
+    for (size_t i = 0; i <= message.size(); i += 20)
+        messages.push_back(std::span(message).first(i));
+
+    std::vector<Fr> scalars(messages.size());
+    Fr::hash_to_scalar_batch("Zcash_RedJubjubH", messages, scalars);
+    for (size_t i = 0; i < messages.size(); ++i)
+        EXPECT_EQ(scalars[i], Fr::hash_to_scalar("Zcash_RedJubjubH", messages[i]));
+
+    const std::string long_domain(17, 'x');
+    EXPECT_THROW(std::ignore = Fr::hash_to_scalar(long_domain, message), std::invalid_argument);
+    EXPECT_THROW(Fr::hash_to_scalar_batch(long_domain, messages, scalars), std::invalid_argument);
+    EXPECT_THROW(Fr::hash_to_scalar_batch(std::string(4096, 'x'), messages, scalars), std::invalid_argument);
+}
+
+TEST(Fr, ToBlsScalar) {
+    OsRng rng{};
+    std::vector<Fr> values(1100);
+    for (auto &value: values)
+        value = Fr::random(rng);
+    values[0] = Fr::zero();
+    values[1] = Fr::one();
+    values[2] = -Fr::one();
+
+    std::vector<bls12_381::scalar::Scalar> scalars(values.size());
+    Fr::to_bls_scalar_batch(values, scalars);
+    for (size_t i = 0; i < values.size(); ++i) {
+        const auto expected = bls12_381::scalar::Scalar::from_bytes(values[i].to_bytes()).value();
+        EXPECT_EQ(values[i].to_bls_scalar().value(), expected);
+        EXPECT_EQ(scalars[i], expected);
+    }
+}
+
 TEST(Fr, AddAssociativity) {
     OsRng rng{};
     for (int i = 0; i < 1000; ++i) {
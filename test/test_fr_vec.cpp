@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "impl/os_rng.h"
+
+#include "field/fr.h"
+#include "field/fr_vec.h"
+
+using rng::impl::OsRng;
+
+using jubjub::field::Fr;
+using jubjub::field::FrVec;
+
+static std::vector<Fr> random_values(size_t n) {
+    OsRng rng{};
+    std::vector<Fr> values(n);
+    for (auto &value: values)
+        value = Fr::random(rng);
+
+    // keep the edges of the field in every batch
+    if (n > 2) {
+        values[0] = Fr::zero();
+        values[1] = -Fr::one();
+    }
+    return values;
+}
+
+TEST(FrVec, Conversion) {
+    const std::vector<Fr> values = random_values(37);
+    const FrVec vec{values};
+
+    EXPECT_EQ(vec.size(), values.size());
+    EXPECT_EQ(vec.to_vector(), values);
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(vec.get(i), values[i]);
+
+    EXPECT_EQ(FrVec(5, Fr::one()).to_vector(), std::vector<Fr>(5, Fr::one()));
+    EXPECT_TRUE(FrVec{}.empty());
+}
+
+TEST(FrVec, Backends) {
+    const size_t n = 37;
+    const std::vector<Fr> xs = random_values(n);
+    std::vector<Fr> ys = random_values(n);
+    ys[2] = xs[2];
+
+    const FrVec a{xs};
+    const FrVec b{ys};
+
+    for (const auto backend: {FrVec::Backend::PORTABLE, FrVec::Backend::AVX2, FrVec::Backend::AVX512_IFMA}) {
+        if (!FrVec::is_supported(backend)) continue;
+
+        FrVec sum, difference, product, square;
+        FrVec::add(sum, a, b, backend);
+        FrVec::sub(difference, a, b, backend);
+        FrVec::mul(product, a, b, backend);
+        FrVec::square(square, a, backend);
+
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(sum.get(i), xs[i] + ys[i]) << static_cast<int>(backend);
+            EXPECT_EQ(difference.get(i), xs[i] - ys[i]) << static_cast<int>(backend);
+            EXPECT_EQ(product.get(i), xs[i] * ys[i]) << static_cast<int>(backend);
+            EXPECT_EQ(square.get(i), xs[i].square()) << static_cast<int>(backend);
+        }
+    }
+}
+
+TEST(FrVec, Operators) {
+    const std::vector<Fr> xs = random_values(100);
+    const std::vector<Fr> ys = random_values(100);
+    const FrVec a{xs};
+    const FrVec b{ys};
+
+    const std::vector<Fr> result = ((a + b) * a - b.square()).to_vector();
+    for (size_t i = 0; i < xs.size(); ++i)
+        EXPECT_EQ(result[i], (xs[i] + ys[i]) * xs[i] - ys[i].square());
+
+    FrVec c = a;
+    c *= b;
+    c += a;
+    c -= b;
+    for (size_t i = 0; i < xs.size(); ++i)
+        EXPECT_EQ(c.get(i), xs[i] * ys[i] + xs[i] - ys[i]);
+}
\ No newline at end of file
@@ -1,23 +1,35 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <tuple>
+#include <vector>
+
+#include "impl/os_rng.h"
 
 #include "scalar/scalar.h"
 
 #include "field/fr.h"
 #include "group/affine.h"
 #include "group/affine_niels.h"
+#include "group/completed.h"
 #include "group/extended.h"
 #include "group/extended_niels.h"
+#include "group/multiply_many.h"
 #include "group/constants.h"
 #include "group/normalize.h"
+#include "group/projective.h"
+#include "group/window.h"
+
+using rng::impl::OsRng;
 
 using bls12_381::scalar::Scalar;
 
+using jubjub::field::Fq;
 using jubjub::field::Fr;
 
 using jubjub::group::Affine;
 using jubjub::group::AffineNiels;
+using jubjub::group::Completed;
 using jubjub::group::Extended;
 using jubjub::group::ExtendedNiels;
 
@@ -67,6 +79,67 @@ TEST(Group, ExtendedNiels) {
     EXPECT_EQ(ExtendedNiels::identity().get_t2d(), ExtendedNiels{Extended::identity()}.get_t2d());
 }
 
+// the completed-point formulas the fused kernels replace, fully reducing every intermediate
+static Extended reference_double(const Extended &p) {
+    const Fq x{p.get_x()}, y{p.get_y()}, z{p.get_z()};
+    const Fq xx = x.square();
+    const Fq yy = y.square();
+    const Fq zz2 = z.square().doubles();
+    const Fq xy2 = (x + y).square();
+    return Extended{Completed{xy2 - (yy + xx), yy + xx, yy - xx, zz2 - (yy - xx)}};
+}
+
+static Extended reference_add(const Extended &p, const ExtendedNiels &q) {
+    const Fq x{p.get_x()}, y{p.get_y()}, z{p.get_z()}, t1{p.get_t1()}, t2{p.get_t2()};
+    const Fq a = (y - x) * Fq{q.get_y_minus_x()};
+    const Fq b = (y + x) * Fq{q.get_y_plus_x()};
+    const Fq c = t1 * t2 * Fq{q.get_t2d()};
+    const Fq d = (z * Fq{q.get_z()}).doubles();
+    return Extended{Completed{b - a, b + a, d + c, d - c}};
+}
+
+static Extended reference_add(const Extended &p, const AffineNiels &q) {
+    const Fq x{p.get_x()}, y{p.get_y()}, z{p.get_z()}, t1{p.get_t1()}, t2{p.get_t2()};
+    const Fq a = (y - x) * Fq{q.get_y_minus_x()};
+    const Fq b = (y + x) * Fq{q.get_y_plus_x()};
+    const Fq c = t1 * t2 * Fq{q.get_t2d()};
+    const Fq d = z.doubles();
+    return Extended{Completed{b - a, b + a, d + c, d - c}};
+}
+
+static void expect_same(const Extended &lhs, const Extended &rhs) {
+    EXPECT_EQ(lhs.get_x(), rhs.get_x());
+    EXPECT_EQ(lhs.get_y(), rhs.get_y());
+    EXPECT_EQ(lhs.get_z(), rhs.get_z());
+    EXPECT_EQ(lhs.get_t1(), rhs.get_t1());
+    EXPECT_EQ(lhs.get_t2(), rhs.get_t2());
+}
+
+TEST(Group, FusedFormulas) {
+    OsRng rng{};
+    std::vector<Extended> points{Extended::identity(), GENERATOR_EXTENDED, -GENERATOR_EXTENDED};
+    for (int i = 0; i < 20; ++i)
+        points.push_back(GENERATOR_EXTENDED * Fr::random(rng));
+
+    for (const Extended &p: points) {
+        expect_same(p.doubles(), reference_double(p));
+        for (const Extended &q: points) {
+            const ExtendedNiels niels{q};
+            const AffineNiels affine_niels{Affine{q}};
+
+            // the fused kernels return the very same coordinates, not just an equivalent point
+            expect_same(p + niels, reference_add(p, niels));
+            expect_same(p - niels, reference_add(p, ExtendedNiels{-q}));
+            expect_same(p + affine_niels, reference_add(p, affine_niels));
+            expect_same(p - affine_niels, reference_add(p, AffineNiels{Affine{-q}}));
+            expect_same(p + q, reference_add(p, niels));
+            expect_same(p - q, reference_add(p, ExtendedNiels{-q}));
+        }
+        EXPECT_TRUE((p - p).is_identity());
+        EXPECT_EQ(p + p, p.doubles());
+    }
+}
+
 TEST(Group, Assoc) {
     const Extended p = Extended{Affine{
             Scalar::from_raw({0x81c571e5d883cfb0, 0x049f7a686f147029, 0xf539c860bc3ea21f, 0x4284715b7ccc8162}),
@@ -225,6 +298,134 @@ TEST(Group, IsIdentity) {
     }
 }
 
+// plain double-and-add over the low 252 bits, as `multiply` used to compute it
+static Extended reference_multiply(const Extended &p, const std::array<uint8_t, 32> &by) {
+    Extended acc = Extended::identity();
+    for (int i = 251; i >= 0; --i) {
+        acc = acc.doubles();
+        if ((by[i / 8] >> (i % 8)) & 1) acc += p;
+    }
+    return acc;
+}
+
+TEST(Group, WindowedMultiply) {
+    OsRng rng{};
+    const Extended p = GENERATOR_EXTENDED * Fr::random(rng);
+
+    const jubjub::group::window::LookupTable table{p};
+    Extended multiple = Extended::identity();
+    for (int8_t digit = 0; digit <= 8; ++digit) {
+        EXPECT_EQ(Extended::identity() + table.select(digit), multiple);
+        EXPECT_EQ(Extended::identity() + table.select(static_cast<int8_t>(-digit)), -multiple);
+        multiple += p;
+    }
+
+    std::vector<std::array<uint8_t, 32>> scalars{{}, FR_MODULUS_BYTES};
+    scalars.push_back({1});
+    scalars.emplace_back().fill(0xff);
+    for (int i = 0; i < 20; ++i)
+        scalars.push_back(Fr::random(rng).to_bytes());
+
+    for (const auto &by: scalars) {
+        const Extended expected = reference_multiply(p, by);
+        EXPECT_EQ(p.multiply(by), expected);
+        EXPECT_EQ(ExtendedNiels{p}.multiply(by), expected);
+        EXPECT_EQ(AffineNiels{Affine{p}}.multiply(by), expected);
+    }
+    EXPECT_TRUE(p.multiply(FR_MODULUS_BYTES).is_identity());
+}
+
+TEST(Group, MultiplyVartime) {
+    OsRng rng{};
+    const Extended p = GENERATOR_EXTENDED * Fr::random(rng);
+
+    std::vector<std::array<uint8_t, 32>> scalars{{}, FR_MODULUS_BYTES};
+    scalars.push_back({1});
+    scalars.push_back({0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x08});
+    scalars.emplace_back().fill(0xff);
+    for (int i = 0; i < 20; ++i)
+        scalars.push_back(Fr::random(rng).to_bytes());
+
+    for (const auto &by: scalars)
+        EXPECT_EQ(p.multiply_vartime(by), reference_multiply(p, by));
+
+    for (int i = 0; i < 20; ++i) {
+        const Fr s = Fr::random(rng);
+        EXPECT_EQ(p.multiply_vartime(s), p * s);
+    }
+    EXPECT_TRUE(p.multiply_vartime(Fr::zero()).is_identity());
+    EXPECT_EQ(p.multiply_vartime(-Fr::one()), -p);
+}
+
+TEST(Group, DoubleScalarMul) {
+    OsRng rng{};
+    const Extended p = GENERATOR_EXTENDED * Fr::random(rng);
+    const Extended q = GENERATOR_EXTENDED * Fr::random(rng);
+
+    std::vector<std::tuple<Fr, Extended, Fr, Extended>> cases{
+            {Fr::zero(), p, Fr::zero(), q},
+            {Fr::zero(), p, Fr::random(rng), q},
+            {Fr::random(rng), p, Fr::zero(), q},
+            {Fr::random(rng), p, Fr::random(rng), p},
+            {Fr::random(rng), p, Fr::random(rng), -p},
+            {-Fr::one(), p, Fr::one(), q},
+    };
+    for (int i = 0; i < 10; ++i)
+        cases.emplace_back(Fr::random(rng), p, Fr::random(rng), q);
+
+    for (const auto &[a, x, b, y]: cases) {
+        const Extended expected = x * a + y * b;
+        EXPECT_EQ(Extended::double_scalar_mul(a, x, b, y), expected);
+        EXPECT_EQ(Extended::double_scalar_mul_vartime(a, x, b, y), expected);
+    }
+}
+
+TEST(Group, Projective) {
+    using jubjub::group::Projective;
+
+    OsRng rng{};
+    const Extended p = GENERATOR_EXTENDED * Fr::random(rng);
+
+    EXPECT_TRUE(Projective{Extended::identity()}.is_identity());
+    EXPECT_TRUE(Projective::identity().doubles().is_identity());
+    EXPECT_EQ(Projective{p}.doubles(), Projective{p.doubles()});
+    EXPECT_EQ(Extended{Projective{p}.double_completed()}, p.doubles());
+    EXPECT_EQ(Projective{Projective{p}.double_completed()}, Projective{p + p});
+
+    Extended expected = p;
+    for (uint32_t k = 0; k <= 8; ++k) {
+        const Extended doubled = p.double_n(k);
+        EXPECT_EQ(doubled, expected);
+        EXPECT_TRUE(doubled.is_on_curve());
+        expected = expected.doubles();
+    }
+    Extended eight = Extended::identity();
+    for (int i = 0; i < 8; ++i)
+        eight += p;
+    EXPECT_EQ(p.mul_by_cofactor(), eight);
+    EXPECT_TRUE(Extended::identity().double_n(5).is_identity());
+}
+
+TEST(Group, MultiplyMany) {
+    OsRng rng{};
+
+    // sizes on both sides of the normalization threshold, with and without a partial group of lanes
+    for (const size_t n: {size_t{0}, size_t{1}, size_t{2}, size_t{3}, size_t{7}, size_t{8}, size_t{9}, size_t{17}}) {
+        for (const Fr &s: {Fr::zero(), Fr::one(), -Fr::one(), Fr::random(rng)}) {
+            std::vector<Extended> points;
+            for (size_t i = 0; i < n; ++i)
+                points.push_back(i == 1 ? Extended::identity() : GENERATOR_EXTENDED * Fr::random(rng));
+
+            std::vector<Extended> expected;
+            for (const Extended &p: points)
+                expected.push_back(p * s);
+
+            jubjub::group::multiply_many(s, points);
+            EXPECT_EQ(points, expected);
+        }
+    }
+}
+
 TEST(Group, MulConsistency) {
     const Fr a{{0x21e61211d9934f2e, 0xa52c058a693c3e07, 0x9ccb77bfb12d6360, 0x07df2470ec94398e}};
     const Fr b{{0x03336d1cbe19dbe0, 0x0153618f6156a536, 0x2604c9e1fc3c6b15, 0x04ae581ceb028720}};
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "impl/os_rng.h"
+
+#include "field/fr.h"
+#include "group/affine.h"
+#include "group/constants.h"
+#include "group/extended.h"
+#include "group/msm.h"
+
+using rng::impl::OsRng;
+
+using jubjub::field::Fr;
+using jubjub::group::Affine;
+using jubjub::group::Extended;
+using jubjub::group::msm;
+
+using jubjub::group::constant::GENERATOR_EXTENDED;
+
+static std::vector<Extended> random_points(OsRng &rng, size_t n) {
+    // multiples of a random point keep the setup cheap
+    std::vector<Extended> points;
+    if (n == 0) return points;
+    points.push_back(GENERATOR_EXTENDED * Fr::random(rng));
+    while (points.size() < n)
+        points.push_back(points.back() + points.front());
+    return points;
+}
+
+static Extended naive(const std::vector<Extended> &points, const std::vector<Fr> &scalars) {
+    // sum(s_i * (i + 1) * P) = (sum(s_i * (i + 1))) * P for the points of `random_points`
+    Fr sum = Fr::zero();
+    for (size_t i = 0; i < scalars.size(); ++i)
+        sum += scalars[i] * Fr{static_cast<uint64_t>(i + 1)};
+    return points.front() * sum;
+}
+
+TEST(Msm, MatchesNaive) {
+    OsRng rng{};
+    for (size_t n: {0, 1, 2, 7, 64, 300, 1500}) {
+        const std::vector<Extended> points = random_points(rng, n);
+        std::vector<Fr> scalars;
+        for (size_t i = 0; i < n; ++i)
+            scalars.push_back(Fr::random(rng));
+        if (n > 2) {
+            scalars[0] = Fr::zero();
+            scalars[1] = -Fr::one();
+        }
+
+        const Extended expected = n == 0 ? Extended::identity() : naive(points, scalars);
+        EXPECT_EQ(msm(points, scalars), expected) << n;
+        EXPECT_EQ(msm(points, scalars, 4), expected) << n;
+
+        std::vector<Affine> affine;
+        for (const Extended &point: points)
+            affine.emplace_back(point);
+        EXPECT_EQ(msm(affine, scalars), expected) << n;
+    }
+}
+
+TEST(Msm, RepeatedPoints) {
+    OsRng rng{};
+    const Extended p = GENERATOR_EXTENDED * Fr::random(rng);
+    const std::vector<Extended> points(4500, p);
+
+    std::vector<Fr> scalars;
+    Fr sum = Fr::zero();
+    for (size_t i = 0; i < points.size(); ++i) {
+        scalars.push_back(Fr::random(rng));
+        sum += scalars.back();
+    }
+    EXPECT_EQ(msm(points, scalars, 3), p * sum);
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "impl/os_rng.h"
+
+#include "field/fr.h"
+#include "sharing/shamir.h"
+
+using rng::impl::OsRng;
+
+using jubjub::field::Fr;
+using jubjub::sharing::Polynomial;
+using jubjub::sharing::Share;
+using jubjub::sharing::SignerSet;
+
+TEST(Shamir, Evaluate) {
+    OsRng rng{};
+    const Polynomial polynomial = Polynomial::random(Fr::random(rng), 7, rng);
+
+    std::vector<Fr> xs(50);
+    for (auto &x: xs)
+        x = Fr::random(rng);
+    std::vector<Fr> ys(xs.size());
+    polynomial.evaluate(xs, ys);
+
+    for (size_t i = 0; i < xs.size(); ++i) {
+        Fr expected = Fr::zero();
+        Fr power = Fr::one();
+        for (const Fr &coefficient: polynomial.get_coefficients()) {
+            expected += coefficient * power;
+            power *= xs[i];
+        }
+        EXPECT_EQ(ys[i], expected);
+        EXPECT_EQ(polynomial.evaluate(xs[i]), expected);
+    }
+}
+
+TEST(Shamir, SplitReconstruct) {
+    OsRng rng{};
+    const Fr secret = Fr::random(rng);
+    const Polynomial polynomial = Polynomial::random(secret, 3, rng);
+    const std::vector<Share> shares = polynomial.split(5);
+
+    EXPECT_EQ(jubjub::sharing::reconstruct(shares).value(), secret);
+    EXPECT_EQ(jubjub::sharing::reconstruct(std::span(shares).subspan(2)).value(), secret);
+
+    // below the threshold the secret stays hidden
+    EXPECT_NE(jubjub::sharing::reconstruct(std::span(shares).first(2)).value(), secret);
+}
+
+TEST(Shamir, SignerSet) {
+    OsRng rng{};
+    const std::vector<Fr> indices = {Fr{2u}, Fr{5u}, Fr{9u}};
+    const auto signers = SignerSet::from_indices(indices).value();
+
+    // the cached coefficients serve any polynomial over the same indices
+    for (int i = 0; i < 10; ++i) {
+        const Fr secret = Fr::random(rng);
+        const Polynomial polynomial = Polynomial::random(secret, 3, rng);
+
+        std::vector<Share> shares;
+        for (const Fr &index: indices)
+            shares.push_back(Share{index, polynomial.evaluate(index)});
+        EXPECT_EQ(signers.reconstruct(shares).value(), secret);
+    }
+
+    const std::vector<Share> reordered = {{Fr{5u}, Fr::one()}, {Fr{2u}, Fr::one()}, {Fr{9u}, Fr::one()}};
+    EXPECT_FALSE(signers.reconstruct(reordered).has_value());
+}
+
+TEST(Shamir, InvalidIndices) {
+    EXPECT_FALSE(SignerSet::from_indices(std::vector<Fr>{Fr{1u}, Fr{2u}, Fr{1u}}).has_value());
+    EXPECT_FALSE(SignerSet::from_indices(std::vector<Fr>{Fr{1u}, Fr::zero()}).has_value());
+    EXPECT_FALSE(SignerSet::from_indices(std::vector<Fr>{}).has_value());
+}
\ No newline at end of file